@@ -0,0 +1,348 @@
+// argy_bench: reproducible microbenchmarks with JSON output for regression tracking
+//
+// Every case has fixed inputs and no randomness. The time per operation is calibrated to run for about
+// --min-time milliseconds, then measured --repetitions times; the JSON reports the median and the minimum.
+//
+//   argy_bench                          all cases, JSON on stdout
+//   argy_bench --filter parse/ -o x.json
+#include "argy.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace Argy;
+
+namespace {
+    /// One benchmark: op() is timed, items is the work it does per call (tokens, options, values, ...)
+    struct Case {
+        std::string name;
+        double items;
+        std::function<void()> op;
+    };
+
+    struct Measurement {
+        std::string name;
+        size_t iterations = 0;
+        double items = 0;
+        std::vector<double> nsPerOp; ///< One entry per repetition
+    };
+
+    volatile long long g_sink = 0;
+
+    std::vector<std::string_view> views(const std::vector<std::string>& tokens) {
+        return std::vector<std::string_view>(tokens.begin(), tokens.end());
+    }
+
+    std::string optionName(size_t i) { return "--option-" + std::to_string(i); }
+
+    /// A parser with `count` int options named --option-<i>
+    std::shared_ptr<CliParser> intParser(size_t count) {
+        auto parser = std::make_shared<CliParser>(0, nullptr);
+        for (size_t i = 0; i < count; ++i) parser->add<int>({optionName(i)}, "Generated option", 0);
+        return parser;
+    }
+
+    /// A stream buffer that discards everything, for timing printHelp() without a terminal
+    class NullBuffer : public std::streambuf {
+    protected:
+        int overflow(int c) override { return c; }
+        std::streamsize xsputn(const char*, std::streamsize n) override { return n; }
+    };
+
+    std::vector<Case> makeCases(const std::filesystem::path& scratch) {
+        std::vector<Case> cases;
+
+        // Parse throughput against argv length: alternating option/value pairs over 64 options
+        for (size_t length : {8, 64, 512, 4096}) {
+            auto parser = intParser(64);
+            auto tokens = std::make_shared<std::vector<std::string>>(std::vector<std::string>{"bench"});
+            for (size_t i = 0; i < length / 2; ++i) {
+                tokens->push_back(optionName((i * 37) % 64));
+                tokens->push_back(std::to_string(i));
+            }
+            auto args = std::make_shared<std::vector<std::string_view>>(views(*tokens));
+            cases.push_back({"parse/argv_length/" + std::to_string(length), double(args->size() - 1), [parser, tokens, args] {
+                g_sink = g_sink + CliParser::parse(parser->schema(), *args).getInt("option-0");
+            }});
+        }
+
+        // Parse throughput against schema size: the same 8 tokens, more registered options
+        for (size_t options : {10, 100, 1000, 10000}) {
+            auto parser = intParser(options);
+            auto tokens = std::make_shared<std::vector<std::string>>(std::vector<std::string>{"bench"});
+            for (size_t i = 0; i < 4; ++i) {
+                tokens->push_back(optionName((i * 7919) % options));
+                tokens->push_back(std::to_string(i));
+            }
+            auto args = std::make_shared<std::vector<std::string_view>>(views(*tokens));
+            cases.push_back({"parse/schema_size/" + std::to_string(options), 8, [parser, tokens, args] {
+                g_sink = g_sink + CliParser::parse(parser->schema(), *args).getInt("option-0");
+            }});
+        }
+
+        // Parse throughput against list length
+        for (size_t length : {1, 16, 256, 4096}) {
+            auto parser = std::make_shared<CliParser>(0, nullptr);
+            parser->addInts("--values", "Values");
+            auto tokens = std::make_shared<std::vector<std::string>>(std::vector<std::string>{"bench", "--values"});
+            for (size_t i = 0; i < length; ++i) tokens->push_back(std::to_string(i * 31));
+            auto args = std::make_shared<std::vector<std::string_view>>(views(*tokens));
+            cases.push_back({"parse/list_length/" + std::to_string(length), double(length), [parser, tokens, args] {
+                g_sink = g_sink + static_cast<long long>(CliParser::parse(parser->schema(), *args).getInts("values").size());
+            }});
+        }
+
+        // The same lists marked lazy and never read: parse only copies their tokens
+        for (size_t length : {256, 4096}) {
+            auto parser = std::make_shared<CliParser>(0, nullptr);
+            parser->addInts("--values", "Values").lazy();
+            auto tokens = std::make_shared<std::vector<std::string>>(std::vector<std::string>{"bench", "--values"});
+            for (size_t i = 0; i < length; ++i) tokens->push_back(std::to_string(i * 31));
+            auto args = std::make_shared<std::vector<std::string_view>>(views(*tokens));
+            cases.push_back({"parse/lazy_list_unread/" + std::to_string(length), double(length), [parser, tokens, args] {
+                g_sink = g_sink + static_cast<long long>(CliParser::parse(parser->schema(), *args).has("values"));
+            }});
+        }
+
+        // Parse throughput against alias count: 16 options with `aliases` names each, the last one used
+        for (size_t aliases : {1, 4, 16, 64}) {
+            auto parser = std::make_shared<CliParser>(0, nullptr);
+            auto tokens = std::make_shared<std::vector<std::string>>(std::vector<std::string>{"bench"});
+            for (size_t i = 0; i < 16; ++i) {
+                std::vector<std::string> names;
+                for (size_t a = 0; a < aliases; ++a) names.push_back("--opt-" + std::to_string(i) + "-alias-" + std::to_string(a));
+                parser->add<int>(names, "Aliased option", 0);
+                tokens->push_back(names.back());
+                tokens->push_back(std::to_string(i));
+            }
+            auto args = std::make_shared<std::vector<std::string_view>>(views(*tokens));
+            cases.push_back({"parse/aliases/" + std::to_string(aliases), double(args->size() - 1), [parser, tokens, args] {
+                g_sink = g_sink + CliParser::parse(parser->schema(), *args).getInt("opt-0-alias-0");
+            }});
+        }
+
+        // Registration cost: building a parser with N options
+        for (size_t options : {10, 100, 1000, 10000}) {
+            auto names = std::make_shared<std::vector<std::string>>();
+            for (size_t i = 0; i < options; ++i) names->push_back(optionName(i));
+            cases.push_back({"register/" + std::to_string(options), double(options), [names] {
+                CliParser parser(0, nullptr);
+                for (const std::string& name : *names) parser.add<int>({name}, "Generated option", 0);
+                g_sink = g_sink + static_cast<long long>(parser.schema()->arguments.size());
+            }});
+        }
+
+        // get<T> cost on a parsed result
+        {
+            auto parser = std::make_shared<CliParser>(0, nullptr);
+            Arg<int> count = parser->addInt({"-n", "--count"}, "Count", 1);
+            Arg<Strings> files = parser->addStrings({"-f", "--files"}, "Files");
+            std::vector<std::string_view> args = {"bench", "-n", "42", "-f", "a.txt", "b.txt", "c.txt", "d.txt"};
+            auto parsed = std::make_shared<ParsedArgs>(CliParser::parse(parser->schema(), args));
+            cases.push_back({"get/int_by_name", 1, [parsed] { g_sink = g_sink + parsed->get<int>("count"); }});
+            cases.push_back({"get/int_by_handle", 1, [parsed, count] { g_sink = g_sink + (*parsed)[count]; }});
+            cases.push_back({"get/strings_by_name", 1, [parsed] {
+                g_sink = g_sink + static_cast<long long>(parsed->get<Strings>("files").size());
+            }});
+            cases.push_back({"get/strings_by_handle", 1, [parsed, files] {
+                g_sink = g_sink + static_cast<long long>((*parsed)[files].size());
+            }});
+        }
+
+        // Validator cost, one value per call
+        {
+            auto range = IsValueInRange(0, 100);
+            cases.push_back({"validate/range", 1, [range] { range("count", 42); }});
+            auto oneOf = IsOneOf({"fast", "exact", "balanced", "debug"});
+            cases.push_back({"validate/one_of", 1, [oneOf] { oneOf("mode", "balanced"); }});
+            auto match = IsMatch("[a-z]+(-[a-z0-9]+)*@[a-z]+\\.(com|org|net)");
+            cases.push_back({"validate/regex_automaton", 1, [match] { match("pattern", "build-server-42@example.org"); }});
+            auto fallback = IsMatch("(a+)b\\1");
+            cases.push_back({"validate/regex_std", 1, [fallback] { fallback("pattern", "aaabaaa"); }});
+            auto email = IsEmail();
+            cases.push_back({"validate/email", 1, [email] { email("email", "someone.else@example.co.uk"); }});
+            auto ipv6 = IsIPv6();
+            cases.push_back({"validate/ipv6", 1, [ipv6] { ipv6("address", "2001:db8:85a3::8a2e:370:7334"); }});
+
+            std::filesystem::create_directories(scratch);
+            std::string file = (scratch / "input.txt").string();
+            std::ofstream(file) << "argy";
+            auto isFile = IsFile();
+            cases.push_back({"validate/file", 1, [isFile, file] { isFile("input", file); }});
+            auto isDirectory = IsDirectory();
+            std::string directory = scratch.string();
+            cases.push_back({"validate/directory", 1, [isDirectory, directory] { isDirectory("dir", directory); }});
+        }
+
+        // printHelp rendering, output discarded
+        for (size_t options : {10, 100, 1000}) {
+            auto parser = std::make_shared<CliParser>(0, nullptr, false);
+            parser->addString("input", "Input file");
+            for (size_t i = 1; i < options; ++i) parser->add<int>({"-o" + std::to_string(i), optionName(i)}, "Generated option", int(i));
+            cases.push_back({"help/options/" + std::to_string(options), double(options), [parser] {
+                static NullBuffer null;
+                std::streambuf* previous = std::cout.rdbuf(&null);
+                parser->printHelp("bench");
+                std::cout.rdbuf(previous);
+            }});
+            cases.push_back({"help/stream/" + std::to_string(options), double(options), [parser] {
+                static NullBuffer null;
+                std::ostream os(&null);
+                parser->streamHelp(os, "bench");
+            }});
+        }
+
+        // Help search once the index is built: one rare word and one common word
+        for (size_t options : {1000, 100000}) {
+            auto parser = std::make_shared<CliParser>(0, nullptr, false);
+            for (size_t i = 0; i < options; ++i)
+                parser->add<int>({optionName(i)}, i % 100 == 0 ? "Color of the output" : "Generated option", int(i));
+            parser->searchHelp("color");
+            cases.push_back({"help/search/" + std::to_string(options), 1, [parser] {
+                if (parser->searchHelp("output color").size() == 0) std::abort();
+            }});
+        }
+        return cases;
+    }
+
+    double nowNs() {
+        return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    Measurement measure(const Case& c, double minTimeMs, int repetitions) {
+        Measurement m;
+        m.name = c.name;
+        m.items = c.items;
+        // Calibrate: double the batch until one batch takes at least minTimeMs
+        size_t iterations = 1;
+        for (;;) {
+            double start = nowNs();
+            for (size_t i = 0; i < iterations; ++i) c.op();
+            double elapsed = nowNs() - start;
+            if (elapsed >= minTimeMs * 1e6 || iterations >= (size_t(1) << 30)) break;
+            double scale = elapsed > 0 ? std::min(10.0, 1.4 * minTimeMs * 1e6 / elapsed) : 10.0;
+            iterations = std::max(iterations + 1, static_cast<size_t>(static_cast<double>(iterations) * scale));
+        }
+        m.iterations = iterations;
+        for (int r = 0; r < repetitions; ++r) {
+            double start = nowNs();
+            for (size_t i = 0; i < iterations; ++i) c.op();
+            m.nsPerOp.push_back((nowNs() - start) / static_cast<double>(iterations));
+        }
+        return m;
+    }
+
+    std::string jsonString(const std::string& text) {
+        std::string out = "\"";
+        for (char c : text) {
+            if (c == '"' || c == '\\') out += '\\';
+            out += c;
+        }
+        return out + "\"";
+    }
+
+    std::string compilerName() {
+#if defined(__clang__)
+        return "clang " __clang_version__;
+#elif defined(__GNUC__)
+        return "gcc " __VERSION__;
+#elif defined(_MSC_VER)
+        return "msvc " + std::to_string(_MSC_VER);
+#else
+        return "unknown";
+#endif
+    }
+
+    void writeJson(std::ostream& os, const std::vector<Measurement>& results, double minTimeMs, int repetitions) {
+        char buffer[64];
+        os << "{\n"
+           << "  \"context\": {\n"
+           << "    \"compiler\": " << jsonString(compilerName()) << ",\n"
+#ifdef NDEBUG
+           << "    \"assertions\": false,\n"
+#else
+           << "    \"assertions\": true,\n"
+#endif
+           << "    \"min_time_ms\": " << minTimeMs << ",\n"
+           << "    \"repetitions\": " << repetitions << "\n"
+           << "  },\n"
+           << "  \"benchmarks\": [";
+        for (size_t i = 0; i < results.size(); ++i) {
+            const Measurement& m = results[i];
+            std::vector<double> sorted = m.nsPerOp;
+            std::sort(sorted.begin(), sorted.end());
+            double median = sorted.size() % 2 ? sorted[sorted.size() / 2]
+                                              : (sorted[sorted.size() / 2 - 1] + sorted[sorted.size() / 2]) / 2;
+            double mean = 0;
+            for (double v : sorted) mean += v / static_cast<double>(sorted.size());
+            double variance = 0;
+            for (double v : sorted) variance += (v - mean) * (v - mean) / static_cast<double>(sorted.size());
+            os << (i ? ",\n" : "\n") << "    {\"name\": " << jsonString(m.name) << ", \"iterations\": " << m.iterations;
+            std::snprintf(buffer, sizeof(buffer), "%.3f", median);
+            os << ", \"median_ns\": " << buffer;
+            std::snprintf(buffer, sizeof(buffer), "%.3f", sorted.front());
+            os << ", \"min_ns\": " << buffer;
+            std::snprintf(buffer, sizeof(buffer), "%.3f", std::sqrt(variance));
+            os << ", \"stddev_ns\": " << buffer;
+            std::snprintf(buffer, sizeof(buffer), "%.0f", m.items);
+            os << ", \"items_per_op\": " << buffer;
+            std::snprintf(buffer, sizeof(buffer), "%.1f", m.items * 1e9 / median);
+            os << ", \"items_per_second\": " << buffer << "}";
+        }
+        os << "\n  ]\n}\n";
+    }
+}
+
+int main(int argc, char* argv[]) {
+    CliParser cli(argc, argv);
+    cli.setHelpDescription("Run the Argy microbenchmarks and print the results as JSON.");
+    cli.addString({"-f", "--filter"}, "Run only cases whose name contains this text", "");
+    cli.addString({"-o", "--output"}, "Write the JSON to this file instead of stdout", "");
+    cli.addFloat({"-t", "--min-time"}, "Milliseconds per measured batch", 50.0f).isInRange(0.1f, 10000.0f);
+    cli.addInt({"-r", "--repetitions"}, "Measured batches per case", 5).isInRange(1, 1000);
+    cli.addBool({"-l", "--list"}, "List the case names and exit");
+    try {
+        auto args = cli.parse();
+        std::filesystem::path scratch = std::filesystem::temp_directory_path() / "argy_bench";
+        std::vector<Case> cases = makeCases(scratch);
+        std::string filter = args.getString("filter");
+        if (args.getBool("list")) {
+            for (const Case& c : cases)
+                if (c.name.find(filter) != std::string::npos) std::cout << c.name << "\n";
+            return 0;
+        }
+
+        std::vector<Measurement> results;
+        for (const Case& c : cases) {
+            if (c.name.find(filter) == std::string::npos) continue;
+            std::cerr << c.name << "\n";
+            results.push_back(measure(c, args.getFloat("min-time"), args.getInt("repetitions")));
+        }
+        std::filesystem::remove_all(scratch);
+
+        std::string output = args.getString("output");
+        if (output.empty()) {
+            writeJson(std::cout, results, args.getFloat("min-time"), args.getInt("repetitions"));
+        }
+        else {
+            std::ofstream out(output);
+            writeJson(out, results, args.getFloat("min-time"), args.getInt("repetitions"));
+            if (!out) {
+                std::cerr << "argy_bench: cannot write " << output << "\n";
+                return 1;
+            }
+        }
+    }
+    catch (const Argy::Exception& e) {
+        std::cerr << "argy_bench: " << e.what() << "\n";
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,62 @@
+// Benchmark: reading parsed values by name versus through typed Arg<T> handles
+#include "argy.hpp"
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+using namespace Argy;
+
+template<typename F>
+static double bestOf(int repeats, F&& fn) {
+    double best = 1e300;
+    for (int r = 0; r < repeats; ++r) {
+        auto start = std::chrono::steady_clock::now();
+        fn();
+        double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        if (ms < best) best = ms;
+    }
+    return best;
+}
+
+int main() {
+    const size_t reads = 1000000;
+    const int repeats = 5;
+    CliParser parser(0, nullptr);
+    Arg<int> batch = parser.addInt("--batch-size", "Rows per batch", 64);
+    Arg<std::vector<int>> shards = parser.addInts("--shards", "Shard ids");
+    std::vector<std::string> ids;
+    for (int i = 0; i < 256; ++i) ids.push_back(std::to_string(i));
+    std::vector<std::string_view> args = {"bench", "--batch-size", "128", "--shards"};
+    args.insert(args.end(), ids.begin(), ids.end());
+    ParsedArgs parsed = parser.parse(args);
+
+    volatile long long sink = 0;
+    double intByName = bestOf(repeats, [&] {
+        long long sum = 0;
+        for (size_t i = 0; i < reads; ++i) sum += parsed.getInt("batch-size");
+        sink = sink + sum;
+    });
+    double intByHandle = bestOf(repeats, [&] {
+        long long sum = 0;
+        for (size_t i = 0; i < reads; ++i) sum += parsed[batch];
+        sink = sink + sum;
+    });
+    double listByName = bestOf(repeats, [&] {
+        long long sum = 0;
+        for (size_t i = 0; i < reads; ++i) sum += parsed.getInts("shards")[i & 255];
+        sink = sink + sum;
+    });
+    double listByHandle = bestOf(repeats, [&] {
+        long long sum = 0;
+        for (size_t i = 0; i < reads; ++i) sum += parsed[shards][i & 255];
+        sink = sink + sum;
+    });
+
+    std::printf("%-28s %12s %12s %9s\n", "1M reads", "by name", "Arg<T>", "speedup");
+    std::printf("%-28s %10.2fns %10.2fns %8.1fx\n", "int --batch-size", intByName * 1e6 / reads,
+                intByHandle * 1e6 / reads, intByName / intByHandle);
+    std::printf("%-28s %10.2fns %10.2fns %8.1fx\n", "vector<int> --shards (256)", listByName * 1e6 / reads,
+                listByHandle * 1e6 / reads, listByName / listByHandle);
+    return 0;
+}
@@ -0,0 +1,74 @@
+// Benchmark: numeric list conversion, std::from_chars path versus the former std::stoi/std::stof path
+#include "argy.hpp"
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+using namespace Argy;
+
+template<typename F>
+static double bestOf(int repeats, F&& fn) {
+    double best = 1e300;
+    for (int r = 0; r < repeats; ++r) {
+        auto start = std::chrono::steady_clock::now();
+        fn();
+        double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        if (ms < best) best = ms;
+    }
+    return best;
+}
+
+int main() {
+    const size_t count = 1000000;
+    const int repeats = 5;
+    std::vector<std::string> ints, floats;
+    ints.reserve(count);
+    floats.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        ints.push_back(std::to_string(static_cast<int>(i * 2654435761u % 2000000) - 1000000));
+        floats.push_back(std::to_string(static_cast<float>(i % 100000) / 7.0f));
+    }
+    std::vector<std::string_view> intViews(ints.begin(), ints.end());
+    std::vector<std::string_view> floatViews(floats.begin(), floats.end());
+
+    volatile long long sink = 0;
+    double stoiMs = bestOf(repeats, [&] {
+        std::vector<int> out;
+        out.reserve(count);
+        for (auto v : intViews) out.push_back(std::stoi(std::string(v)));
+        sink = sink + out.back();
+    });
+    double intMs = bestOf(repeats, [&] {
+        std::vector<int> out(count);
+        for (size_t i = 0; i < count; ++i) CliData::toNumber(intViews[i], out[i]);
+        sink = sink + out.back();
+    });
+    double stofMs = bestOf(repeats, [&] {
+        std::vector<float> out;
+        out.reserve(count);
+        for (auto v : floatViews) out.push_back(std::stof(std::string(v)));
+        sink = sink + static_cast<long long>(out.back());
+    });
+    double floatMs = bestOf(repeats, [&] {
+        std::vector<float> out(count);
+        for (size_t i = 0; i < count; ++i) CliData::toNumber(floatViews[i], out[i]);
+        sink = sink + static_cast<long long>(out.back());
+    });
+
+    // End to end: one parse of a 1M-element --ids and --weights list
+    CliParser parser(0, nullptr);
+    parser.addInts("--ids", "Sample ids");
+    parser.addFloats("--weights", "Sample weights");
+    std::vector<std::string_view> args = {"bench", "--ids"};
+    args.insert(args.end(), intViews.begin(), intViews.end());
+    args.push_back("--weights");
+    args.insert(args.end(), floatViews.begin(), floatViews.end());
+    double parseMs = bestOf(repeats, [&] { sink = sink + parser.parse(args).getInts("ids").size(); });
+
+    std::printf("%-24s %12s %12s %8s\n", "1M-element list", "stoi/stof", "from_chars", "speedup");
+    std::printf("%-24s %10.1fms %10.1fms %7.2fx\n", "int", stoiMs, intMs, stoiMs / intMs);
+    std::printf("%-24s %10.1fms %10.1fms %7.2fx\n", "float", stofMs, floatMs, stofMs / floatMs);
+    std::printf("%-24s %23.1fms\n", "parse(--ids --weights)", parseMs);
+    return 0;
+}
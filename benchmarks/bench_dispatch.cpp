@@ -0,0 +1,51 @@
+// Benchmark: per-token option dispatch cost in CliParser::parse() versus schema size
+#include "argy.hpp"
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+using namespace Argy;
+
+// Parses `tokens` against a schema of `optionCount` int options and returns the
+// best wall time in nanoseconds over `repeats` runs.
+static double timeParse(size_t optionCount, const std::vector<std::string>& tokens, int repeats) {
+    std::vector<char*> argv;
+    argv.push_back(const_cast<char*>("bench"));
+    for (const auto& t : tokens) argv.push_back(const_cast<char*>(t.c_str()));
+
+    double best = 1e300;
+    for (int r = 0; r < repeats; ++r) {
+        CliParser parser(static_cast<int>(argv.size()), argv.data());
+        for (size_t i = 0; i < optionCount; ++i) {
+            parser.add<int>({"-o" + std::to_string(i), "--option-" + std::to_string(i)}, "Generated option", 0);
+        }
+        auto start = std::chrono::steady_clock::now();
+        parser.parse();
+        auto end = std::chrono::steady_clock::now();
+        double ns = std::chrono::duration<double, std::nano>(end - start).count();
+        if (ns < best) best = ns;
+    }
+    return best;
+}
+
+int main() {
+    const size_t tokenPairs = 2000;
+    const int repeats = 5;
+    std::printf("%10s %14s %14s %12s\n", "options", "parse(ns)", "baseline(ns)", "ns/token");
+    for (size_t optionCount : {10, 100, 1000, 10000}) {
+        // Alternate long and short spellings, spread across the whole schema
+        std::vector<std::string> tokens;
+        for (size_t i = 0; i < tokenPairs; ++i) {
+            size_t id = (i * 7919) % optionCount;
+            tokens.push_back(i % 2 ? "--option-" + std::to_string(id) : "-o" + std::to_string(id));
+            tokens.push_back(std::to_string(i));
+        }
+        // The post-parse default/convert pass is O(options); subtract it to isolate dispatch
+        double baseline = timeParse(optionCount, {}, repeats);
+        double total = timeParse(optionCount, tokens, repeats);
+        double perToken = (total - baseline) / static_cast<double>(tokens.size());
+        std::printf("%10zu %14.0f %14.0f %12.1f\n", optionCount, total, baseline, perToken);
+    }
+    return 0;
+}
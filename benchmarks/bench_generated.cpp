@@ -0,0 +1,60 @@
+// Benchmark: startup and parse with thousands of options, CliParser versus an argy-gen parser
+#include "argy.hpp"
+#include "wide.hpp"
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+using namespace Argy;
+
+template<typename F>
+static double bestOf(int repeats, F&& fn) {
+    double best = 1e300;
+    for (int r = 0; r < repeats; ++r) {
+        auto start = std::chrono::steady_clock::now();
+        fn();
+        double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        if (ms < best) best = ms;
+    }
+    return best;
+}
+
+int main() {
+    const int options = BENCH_WIDE_OPTIONS;
+    const int repeats = 5;
+    const size_t runs = 100000;
+    std::vector<std::string> names;
+    for (int i = 0; i < options; ++i) names.push_back("--opt-" + std::to_string(i));
+    std::vector<std::string_view> args = {"bench", "--opt-7", "70", "--opt-1500", "15", "--opt-1999", "-3"};
+
+    // What a program pays on every start before it can read one value
+    volatile long long sink = 0;
+    double runtimeStartup = bestOf(repeats, [&] {
+        CliParser parser(0, nullptr);
+        for (int i = 0; i < options; ++i) parser.add<int>({names[i]}, "Option " + std::to_string(i), i);
+        sink = sink + parser.parse(args).getInt("opt-7");
+    });
+    double generatedStartup = bestOf(repeats, [&] { sink = sink + wide::parse(args).opt7; });
+
+    CliParser parser(0, nullptr);
+    for (int i = 0; i < options; ++i) parser.add<int>({names[i]}, "Option " + std::to_string(i), i);
+    double runtimeParse = bestOf(repeats, [&] {
+        long long sum = 0;
+        for (size_t i = 0; i < runs; ++i) sum += CliParser::parse(parser.schema(), args).getInt("opt-1500");
+        sink = sink + sum;
+    });
+    double generatedParse = bestOf(repeats, [&] {
+        long long sum = 0;
+        for (size_t i = 0; i < runs; ++i) sum += wide::parse(args).opt1500;
+        sink = sink + sum;
+    });
+
+    std::printf("%d options, 3 given on the command line\n", options);
+    std::printf("%-30s %14s %14s %9s\n", "", "CliParser", "argy-gen", "speedup");
+    std::printf("%-30s %12.1fus %12.1fus %8.0fx\n", "startup: define + first parse", runtimeStartup * 1e3, generatedStartup * 1e3,
+                runtimeStartup / generatedStartup);
+    std::printf("%-30s %12.0fns %12.0fns %8.1fx\n", "parse only (100k runs)", runtimeParse * 1e6 / runs,
+                generatedParse * 1e6 / runs, runtimeParse / generatedParse);
+    return 0;
+}
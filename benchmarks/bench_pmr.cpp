@@ -0,0 +1,79 @@
+// Benchmark: parsing against a 1k-option schema with the default heap versus a monotonic arena
+#include "argy.hpp"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory_resource>
+#include <string>
+#include <vector>
+
+using namespace Argy;
+
+template<typename F>
+static double timeMs(F&& fn) {
+    auto start = std::chrono::steady_clock::now();
+    fn();
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+static void addOptions(CliParser& parser, size_t options) {
+    for (size_t i = 0; i < options; ++i)
+        parser.add<int>({"--option-number-" + std::to_string(i)}, "Option", static_cast<int>(i));
+}
+
+int main(int argc, char** argv) {
+    const size_t options = 1000;
+    const size_t runs = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1000000;
+    volatile long long sink = 0;
+
+    std::vector<std::string_view> args = {"bench", "--option-number-10", "42", "--option-number-500", "7",
+                                          "--option-number-999", "-3"};
+
+    // Schema construction, once per variant
+    double heapBuild = timeMs([&] {
+        CliParser parser(0, nullptr);
+        addOptions(parser, options);
+        sink = sink + static_cast<long long>(parser.schema()->arguments.size());
+    });
+    std::pmr::monotonic_buffer_resource schemaArena;
+    double arenaBuild = timeMs([&] {
+        CliParser parser(0, nullptr, true, &schemaArena);
+        addOptions(parser, options);
+        sink = sink + static_cast<long long>(parser.schema()->arguments.size());
+    });
+
+    CliParser heapParser(0, nullptr);
+    addOptions(heapParser, options);
+    auto heapSchema = heapParser.schema();
+    double heapParse = timeMs([&] {
+        long long sum = 0;
+        for (size_t i = 0; i < runs; ++i) sum += CliParser::parse(heapSchema, args).getInt("option-number-500");
+        sink = sink + sum;
+    });
+
+    // Schema and every parse in arenas; each parse is released in one step
+    std::pmr::monotonic_buffer_resource arenaForSchema;
+    CliParser arenaParser(0, nullptr, true, &arenaForSchema);
+    addOptions(arenaParser, options);
+    auto arenaSchema = arenaParser.schema();
+    std::vector<std::byte> block(options * sizeof(CliData::ArgValue) * 3);
+    double arenaParse = timeMs([&] {
+        long long sum = 0;
+        std::pmr::monotonic_buffer_resource arena(block.data(), block.size());
+        for (size_t i = 0; i < runs; ++i) {
+            {
+                auto parsed = CliParser::parse(arenaSchema, args, &arena);
+                sum += parsed.getInt("option-number-500");
+            }
+            arena.release();
+        }
+        sink = sink + sum;
+    });
+
+    std::printf("%zu-option schema, %zu parses\n", options, runs);
+    std::printf("%-30s %10.2fms\n", "build, default heap", heapBuild);
+    std::printf("%-30s %10.2fms\n", "build, monotonic arena", arenaBuild);
+    std::printf("%-30s %10.0fns\n", "parse, default heap", heapParse * 1e6 / runs);
+    std::printf("%-30s %10.0fns  (%.2fx)\n", "parse, monotonic arena", arenaParse * 1e6 / runs, heapParse / arenaParse);
+    return 0;
+}
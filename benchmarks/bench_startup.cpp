@@ -0,0 +1,56 @@
+// Benchmark: registering 10k, 50k and 100k options, with time and peak memory per size
+// Each size runs in its own process, so that its peak resident set is measured alone.
+#include "argy.hpp"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/resource.h>
+#endif
+
+using namespace Argy;
+
+/// Peak resident set of this process in MiB, or -1 where unsupported
+static double peakMemoryMiB() {
+#if defined(__APPLE__)
+    rusage usage{};
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_maxrss / (1024.0 * 1024.0); // bytes
+#elif defined(__unix__)
+    rusage usage{};
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_maxrss / 1024.0; // KiB
+#else
+    return -1;
+#endif
+}
+
+static int runOne(size_t options) {
+    std::vector<std::string> names;
+    names.reserve(options);
+    for (size_t i = 0; i < options; ++i) names.push_back("--feature-" + std::to_string(i));
+    double baseline = peakMemoryMiB();
+
+    auto start = std::chrono::steady_clock::now();
+    CliParser parser(0, nullptr);
+    for (size_t i = 0; i < options; ++i) parser.add<int>({names[i]}, "Feature flag", 0);
+    double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    double peak = peakMemoryMiB();
+    std::printf("%-10zu %12.1fms %12.0fns %12.1fMiB %10.0fB\n", options, ms, ms * 1e6 / options, peak,
+                (peak - baseline) * 1024 * 1024 / options);
+    return parser.schema()->arguments.size() == options ? 0 : 1;
+}
+
+int main(int argc, char* argv[]) {
+    if (argc > 1) return runOne(std::strtoul(argv[1], nullptr, 10));
+    std::printf("%-10s %14s %14s %15s %11s\n", "options", "register", "per option", "peak RSS", "per option");
+    std::fflush(stdout);
+    for (const char* size : {"10000", "50000", "100000"}) {
+        std::string command = "\"" + std::string(argv[0]) + "\" " + size;
+        if (std::system(command.c_str()) != 0) return 1;
+    }
+    return 0;
+}
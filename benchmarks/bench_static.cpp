@@ -0,0 +1,83 @@
+// Benchmark: CliParser setup and parse versus a constexpr Argy::Static schema
+#include "argy.hpp"
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+using namespace Argy;
+
+template<typename F>
+static double bestOf(int repeats, F&& fn) {
+    double best = 1e300;
+    for (int r = 0; r < repeats; ++r) {
+        auto start = std::chrono::steady_clock::now();
+        fn();
+        double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        if (ms < best) best = ms;
+    }
+    return best;
+}
+
+constexpr auto schema = Static::makeSchema(
+    Static::option<std::string_view>("input", "Input file"),
+    Static::option<int>({"-n", "--count"}, "Number of items", 10),
+    Static::option<float>({"-r", "--ratio"}, "Ratio", 0.5f),
+    Static::option<std::string_view>({"-o", "--output"}, "Output file", "out.txt"),
+    Static::option<int>({"-j", "--jobs"}, "Parallel jobs", 1),
+    Static::flag({"-v", "--verbose"}, "Verbose output"),
+    Static::flag({"-q", "--quiet"}, "Quiet output"),
+    Static::option<Static::List<int>>({"-i", "--ids"}, "Ids", {}));
+
+int main() {
+    const size_t runs = 100000;
+    const int repeats = 5;
+    std::vector<std::string_view> args = {"bench", "data.csv", "-n", "42", "--ratio", "0.25", "-o", "x.txt",
+                                          "--jobs", "8", "-v", "--ids", "1", "2", "3", "4"};
+
+    volatile long long sink = 0;
+    double runtimeSetup = bestOf(repeats, [&] {
+        long long sum = 0;
+        for (size_t i = 0; i < runs; ++i) {
+            CliParser parser(0, nullptr);
+            parser.add<std::string>("input", "Input file");
+            parser.add<int>({"-n", "--count"}, "Number of items", 10);
+            parser.add<float>({"-r", "--ratio"}, "Ratio", 0.5f);
+            parser.add<std::string>({"-o", "--output"}, "Output file", std::string("out.txt"));
+            parser.add<int>({"-j", "--jobs"}, "Parallel jobs", 1);
+            parser.add<bool>({"-v", "--verbose"}, "Verbose output");
+            parser.add<bool>({"-q", "--quiet"}, "Quiet output");
+            parser.add<Ints>({"-i", "--ids"}, "Ids", Ints{});
+            auto parsed = parser.parse(args);
+            sum += parsed.getInt("count");
+        }
+        sink = sink + sum;
+    });
+
+    CliParser parser(0, nullptr);
+    parser.add<std::string>("input", "Input file");
+    parser.add<int>({"-n", "--count"}, "Number of items", 10);
+    parser.add<float>({"-r", "--ratio"}, "Ratio", 0.5f);
+    parser.add<std::string>({"-o", "--output"}, "Output file", std::string("out.txt"));
+    parser.add<int>({"-j", "--jobs"}, "Parallel jobs", 1);
+    parser.add<bool>({"-v", "--verbose"}, "Verbose output");
+    parser.add<bool>({"-q", "--quiet"}, "Quiet output");
+    parser.add<Ints>({"-i", "--ids"}, "Ids", Ints{});
+    double runtimeParse = bestOf(repeats, [&] {
+        long long sum = 0;
+        for (size_t i = 0; i < runs; ++i) sum += CliParser::parse(parser.schema(), args).getInt("count");
+        sink = sink + sum;
+    });
+
+    double staticParse = bestOf(repeats, [&] {
+        long long sum = 0;
+        for (size_t i = 0; i < runs; ++i) sum += schema.parse(args).get<schema.indexOf("count")>();
+        sink = sink + sum;
+    });
+
+    std::printf("%-34s %12s %9s\n", "100k command lines (15 tokens)", "per line", "vs static");
+    std::printf("%-34s %10.0fns %8.1fx\n", "CliParser: setup + parse", runtimeSetup * 1e6 / runs, runtimeSetup / staticParse);
+    std::printf("%-34s %10.0fns %8.1fx\n", "CliParser: parse only", runtimeParse * 1e6 / runs, runtimeParse / staticParse);
+    std::printf("%-34s %10.0fns %8.1fx\n", "Static::Schema: parse", staticParse * 1e6 / runs, 1.0);
+    return 0;
+}
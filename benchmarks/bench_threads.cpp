@@ -0,0 +1,60 @@
+// Benchmark: parse throughput against thread count, all threads sharing one schema
+#include "argy.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace Argy;
+
+static std::shared_ptr<const CliParser::Schema> makeSchema() {
+    CliParser parser(0, nullptr);
+    parser.addString("input", "Input file");
+    parser.addInt({"-t", "--threads"}, "Worker threads", 1).isInRange(1, 1024);
+    parser.addFloat({"-r", "--rate"}, "Sampling rate", 1.0f);
+    parser.addBool({"-v", "--verbose"}, "Verbose output");
+    parser.addInts({"-i", "--ids"}, "Sample ids", Ints{});
+    parser.addString({"-m", "--mode"}, "Mode", "fast").isOneOf({"fast", "slow"});
+    return parser.schema();
+}
+
+// Parses `perThread` command lines on each of `threadCount` threads; returns the elapsed seconds
+static double runWorkers(const std::shared_ptr<const CliParser::Schema>& schema, unsigned threadCount, int perThread,
+                         std::atomic<long long>& sink) {
+    std::vector<std::string> storage = {"prog", "file.txt", "--threads", "8", "--ids", "1", "2", "3", "-m", "slow", "-v"};
+    std::vector<std::string_view> tokens(storage.begin(), storage.end());
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> workers;
+    for (unsigned w = 0; w < threadCount; ++w) {
+        workers.emplace_back([&] {
+            long long sum = 0;
+            for (int i = 0; i < perThread; ++i) sum += CliParser::parse(schema, tokens).getInt("threads");
+            sink += sum;
+        });
+    }
+    for (auto& t : workers) t.join();
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main(int argc, char** argv) {
+    const int perThread = argc > 1 ? std::atoi(argv[1]) : 200000;
+    unsigned cores = std::max(1u, std::thread::hardware_concurrency());
+    std::vector<unsigned> counts;
+    for (unsigned t = 1; t < cores; t *= 2) counts.push_back(t);
+    counts.push_back(cores);
+
+    auto schema = makeSchema();
+    std::atomic<long long> sink{ 0 };
+    double single = 0;
+    std::printf("%u cores, %d parses per thread\n", cores, perThread);
+    for (unsigned threads : counts) {
+        double rate = threads * perThread / runWorkers(schema, threads, perThread, sink);
+        if (threads == 1) single = rate;
+        std::printf("threads=%-3u parses/s=%-12.0f speedup=%.2fx\n", threads, rate, rate / single);
+    }
+    return sink.load() == 0;
+}
@@ -0,0 +1,76 @@
+// Benchmark: hand-written address and identifier validators versus the former std::regex patterns
+#include "argy.hpp"
+#include <chrono>
+#include <cstdio>
+#include <regex>
+#include <string>
+#include <vector>
+
+using namespace Argy;
+
+template<typename F>
+static double bestOf(int repeats, F&& fn) {
+    double best = 1e300;
+    for (int r = 0; r < repeats; ++r) {
+        auto start = std::chrono::steady_clock::now();
+        fn();
+        double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        if (ms < best) best = ms;
+    }
+    return best;
+}
+
+struct Case {
+    const char* name;
+    const char* pattern;
+    std::vector<std::string> inputs; // mix of valid and invalid values
+    std::function<bool(const std::string&)> check;
+};
+
+int main() {
+    const size_t rounds = 100000;
+    const int repeats = 5;
+    std::vector<Case> cases = {
+        {"IPv4", R"(\b((25[0-5]|2[0-4][0-9]|1[0-9]{2}|[1-9]?[0-9])\.){3}(25[0-5]|2[0-4][0-9]|1[0-9]{2}|[1-9]?[0-9])\b)",
+            {"192.168.1.1", "10.0.0.255", "256.1.1.1", "not-an-ip"},
+            [](const std::string& v) { return parseIPv4(v).has_value(); }},
+        {"IPv6", R"(\b([0-9a-fA-F]{1,4}:){7}[0-9a-fA-F]{1,4}\b)",
+            {"2001:0db8:85a3:0000:0000:8a2e:0370:7334", "fe80:0:0:0:0:0:0:1", "2001:db8::1", "xyz"},
+            [](const std::string& v) { return parseIPv6(v).has_value(); }},
+        {"MAC", R"(\b([0-9A-Fa-f]{2}[:-]){5}([0-9A-Fa-f]{2})\b)",
+            {"00:1A:2B:3C:4D:5E", "00-1a-2b-3c-4d-5e", "00:1A:2B:3C:4D", "invalid-mac"},
+            [](const std::string& v) { return parseMACAddress(v).has_value(); }},
+        {"UUID", R"(^[0-9a-fA-F]{8}-[0-9a-fA-F]{4}-[0-9a-fA-F]{4}-[0-9a-fA-F]{4}-[0-9a-fA-F]{12}$)",
+            {"123e4567-e89b-12d3-a456-426614174000", "FFFFFFFF-FFFF-FFFF-FFFF-FFFFFFFFFFFF",
+             "123e4567-e89b-12d3-a456-42661417400g", "not-a-uuid"},
+            [](const std::string& v) { return parseUUID(v).has_value(); }},
+        {"Email", R"(^[a-zA-Z0-9._%+-]+@[a-zA-Z0-9.-]+\.[a-zA-Z]{2,}$)",
+            {"user@example.com", "first.last+tag@mail.example.org", "user@localhost", "invalid-email"},
+            [](const std::string& v) { return detail::isEmail(v); }},
+        {"URL", R"(^https?://[a-zA-Z0-9.-]+(?:\.[a-zA-Z]{2,})+.*$)",
+            {"https://www.example.com", "http://example.com:8080/path?q=1", "ftp://example.com", "not-a-url"},
+            [](const std::string& v) { return detail::isUrl(v); }},
+    };
+
+    std::printf("%-18s %14s %14s %8s\n", "validator", "regex", "hand-written", "speedup");
+    volatile size_t sink = 0;
+    for (const auto& c : cases) {
+        const std::regex re(c.pattern);
+        double regexMs = bestOf(repeats, [&] {
+            size_t hits = 0;
+            for (size_t r = 0; r < rounds; ++r)
+                for (const auto& v : c.inputs) hits += std::regex_match(v, re);
+            sink = sink + hits;
+        });
+        double parserMs = bestOf(repeats, [&] {
+            size_t hits = 0;
+            for (size_t r = 0; r < rounds; ++r)
+                for (const auto& v : c.inputs) hits += c.check(v);
+            sink = sink + hits;
+        });
+        double calls = static_cast<double>(rounds * c.inputs.size());
+        std::printf("%-18s %10.1fns/op %10.1fns/op %7.1fx\n", c.name,
+                    regexMs * 1e6 / calls, parserMs * 1e6 / calls, regexMs / parserMs);
+    }
+    return 0;
+}
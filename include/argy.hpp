@@ -24,6 +24,7 @@
 #pragma once
 
 #include <string>
+#include <string_view>
 #include <unordered_map>
 #include <variant>
 #include <vector>
@@ -35,6 +36,46 @@
 #include <algorithm>
 #include <filesystem>
 #include <regex>
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <thread>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <cctype>
+#include <charconv>
+#include <system_error>
+#include <sstream>
+#include <locale>
+#include <limits>
+#include <cstdlib>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <bitset>
+#include <map>
+#include <typeinfo>
+#include <tuple>
+#include <utility>
+#include <initializer_list>
+#include <cerrno>
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+// Errors are reported by throwing unless exceptions are disabled (e.g. -fno-exceptions).
+// Then throwing paths print the error and abort; use CliParser::tryParse() to handle errors as values.
+#if !defined(ARGY_NO_EXCEPTIONS) && !defined(__cpp_exceptions) && !defined(__EXCEPTIONS) && !defined(_CPPUNWIND)
+#define ARGY_NO_EXCEPTIONS
+#endif
+#ifdef ARGY_NO_EXCEPTIONS
+#define ARGY_THROW(ex) ::Argy::detail::fail(ex)
+#else
+#define ARGY_THROW(ex) throw ex
+#endif
 
 /// @brief Namespace for the Argy command-line argument parser library.
 namespace Argy {
@@ -107,6 +148,18 @@ namespace Argy {
         using ValidateException::ValidateException;
     };
 
+    namespace detail {
+        /// @brief Report an error where exceptions are disabled: print it and abort.
+        [[noreturn]] inline void fail(const Exception& ex) {
+            std::cerr << ex.what() << "\n";
+            std::abort();
+        }
+
+        /// @brief std::type_identity for C++17: keeps a parameter out of template argument deduction.
+        template<typename T>
+        struct type_identity { using type = T; };
+    }
+
     // Type aliases for supported vector types
     using Bools = std::vector<bool>;
     using Ints = std::vector<int>;
@@ -122,8 +175,8 @@ namespace Argy {
     auto IsValueInRange(T min, T max) {
         return [min, max](const std::string& name, const T& value) {
             if (value < min || value > max)
-                throw Argy::OutOfRangeException("Argument '" + name + "' value " + std::to_string(value) +
-                                                " is out of range [" + std::to_string(min) + ", " + std::to_string(max) + "]");
+                ARGY_THROW(Argy::OutOfRangeException("Argument '" + name + "' value " + std::to_string(value) +
+                                                " is out of range [" + std::to_string(min) + ", " + std::to_string(max) + "]"));
         };
     }
 
@@ -147,8 +200,8 @@ namespace Argy {
     inline auto IsAlphaNumeric() {
         return [](const std::string& name, const std::string& value) {
             if (!std::all_of(value.begin(), value.end(), ::isalnum)) {
-                throw InvalidValueException("Value '" + value + "' for argument '" + name +
-                    "' must contain only alphanumeric characters");
+                ARGY_THROW(InvalidValueException("Value '" + value + "' for argument '" + name +
+                    "' must contain only alphanumeric characters"));
             }
         };
     }
@@ -159,8 +212,8 @@ namespace Argy {
     inline auto IsAlpha() {
         return [](const std::string& name, const std::string& value) {
             if (!std::all_of(value.begin(), value.end(), ::isalpha)) {
-                throw InvalidValueException("Value '" + value + "' for argument '" + name +
-                    "' must contain only alphabetic characters");
+                ARGY_THROW(InvalidValueException("Value '" + value + "' for argument '" + name +
+                    "' must contain only alphabetic characters"));
             }
         };
     }
@@ -171,8 +224,8 @@ namespace Argy {
     inline auto IsNumeric() {
         return [](const std::string& name, const std::string& value) {
             if (!std::all_of(value.begin(), value.end(), ::isdigit)) {
-                throw InvalidValueException("Value '" + value + "' for argument '" + name +
-                    "' must contain only digits");
+                ARGY_THROW(InvalidValueException("Value '" + value + "' for argument '" + name +
+                    "' must contain only digits"));
             }
         };
     }
@@ -192,7 +245,7 @@ namespace Argy {
                 }
             }
             if (!std::filesystem::exists(p)) {
-                throw InvalidValueException("Value '" + value + "' for argument '" + name + "' does not exist");
+                ARGY_THROW(InvalidValueException("Value '" + value + "' for argument '" + name + "' does not exist"));
             }
         };
     }
@@ -211,7 +264,7 @@ namespace Argy {
                 }
             }
             if (!std::filesystem::exists(p) || !std::filesystem::is_regular_file(p)) {
-                throw InvalidValueException("Value '" + value + "' for argument '" + name + "' is not a valid file path");
+                ARGY_THROW(InvalidValueException("Value '" + value + "' for argument '" + name + "' is not a valid file path"));
             }
         };
     }
@@ -230,7 +283,7 @@ namespace Argy {
                 }
             }
             if (!std::filesystem::exists(p) || !std::filesystem::is_directory(p)) {
-                throw InvalidValueException("Value '" + value + "' for argument '" + name + "' is not a valid directory path");
+                ARGY_THROW(InvalidValueException("Value '" + value + "' for argument '" + name + "' is not a valid directory path"));
             }
         };
     }
@@ -251,45 +304,729 @@ namespace Argy {
         };
         return [validValues, join](const std::string& name, const std::string& value) {
             if (std::find(validValues.begin(), validValues.end(), value) == validValues.end()) {
-                throw InvalidValueException("Value '" + value + "' for argument '" + name +
-                    "' must be one of: " + join(validValues, ", "));
+                ARGY_THROW(InvalidValueException("Value '" + value + "' for argument '" + name +
+                    "' must be one of: " + join(validValues, ", ")));
+            }
+        };
+    }
+
+    namespace detail {
+        /// @brief Get the compiled form of a regex pattern, compiling it on first use.
+        /// Compiled patterns are cached for the life of the process and shared, so validators built
+        /// from the same pattern share one automaton. Matching against a const std::regex is thread-safe.
+        /// @throws std::regex_error if the pattern is invalid.
+        inline std::shared_ptr<const std::regex> compiledRegex(const std::string& pattern) {
+            static std::mutex mutex;
+            static std::unordered_map<std::string, std::shared_ptr<const std::regex>> cache;
+            std::lock_guard<std::mutex> lock(mutex);
+            auto& entry = cache[pattern];
+            if (!entry) entry = std::make_shared<const std::regex>(pattern);
+            return entry;
+        }
+
+        /// @brief Linear-time matcher for the regular subset of ECMAScript patterns.
+        /// Supported: literals, '.', the escapes \d \D \w \W \s \S \t \n \r \f \v and escaped punctuation,
+        /// bracket classes with ranges and negation, capturing and (?:...) groups, '|', and the quantifiers
+        /// * + ? {n} {n,} {n,m} including their lazy forms. '^' and '$' are accepted only as the first and
+        /// last character of the pattern.
+        /// The pattern is compiled to a Thompson NFA and then to a DFA by subset construction. If the DFA would
+        /// exceed maxDfaStates, the NFA is simulated directly instead. Either way a match costs time linear in
+        /// the length of the value, with no backtracking and no recursion. The automaton is immutable once
+        /// compiled, so one instance can be shared by any number of threads.
+        class Automaton {
+        public:
+            /// Largest NFA compile() will build; counted repeats beyond this fall back to std::regex
+            static constexpr size_t maxNfaStates = 20000;
+            /// Largest DFA compile() will build; beyond this the NFA is simulated per match
+            static constexpr size_t maxDfaStates = 4096;
+
+            /// @brief Compile a pattern.
+            /// @return The automaton, or nullptr if the pattern uses a construct outside the supported subset
+            /// (backreferences, lookaround, \b, POSIX classes, anchors mid-pattern, ...) or is malformed.
+            static std::shared_ptr<const Automaton> compile(std::string_view pattern) {
+                Parser parser(pattern);
+                int root = parser.parseAlt();
+                if (root < 0 || !parser.atEnd()) return nullptr;
+
+                auto automaton = std::make_shared<Automaton>();
+                automaton->m_sets = std::move(parser.sets);
+                Frag frag = automaton->emit(parser.nodes, root);
+                if (automaton->m_states.size() > maxNfaStates) return nullptr;
+                automaton->m_start = frag.start;
+                automaton->m_accept = frag.end;
+                automaton->buildDfa();
+                return automaton;
+            }
+
+            /// @brief Check whether the whole text matches, like std::regex_match.
+            bool match(std::string_view text) const {
+                if (deterministic()) {
+                    int state = 0;
+                    for (char c : text) {
+                        state = m_table[static_cast<size_t>(state) * m_classes + m_byteClass[static_cast<unsigned char>(c)]];
+                        if (state < 0) return false;
+                    }
+                    return m_accepting[static_cast<size_t>(state)] != 0;
+                }
+                std::vector<int> current, next, stack;
+                std::vector<unsigned> seen(m_states.size(), 0);
+                unsigned generation = 1;
+                closure(m_start, current, seen, generation, stack);
+                for (char c : text) {
+                    ++generation;
+                    next.clear();
+                    for (int s : current) {
+                        const State& state = m_states[static_cast<size_t>(s)];
+                        if (state.set >= 0 && m_sets[static_cast<size_t>(state.set)][static_cast<unsigned char>(c)])
+                            closure(state.next, next, seen, generation, stack);
+                    }
+                    current.swap(next);
+                    if (current.empty()) return false;
+                }
+                return std::find(current.begin(), current.end(), m_accept) != current.end();
+            }
+
+            /// @brief Whether matching runs on a precomputed DFA rather than by NFA simulation.
+            bool deterministic() const { return !m_table.empty(); }
+
+        private:
+            using ByteSet = std::bitset<256>;
+
+            /// Parsed pattern; Concat with no children is the empty string
+            struct Node {
+                enum Kind { Set, Concat, Alt, Repeat } kind;
+                int set;
+                std::vector<int> children;
+                int min, max; // Repeat bounds, max < 0 for unbounded
+            };
+
+            /// NFA state: consumes a byte in m_sets[set] and moves to next, or (set < 0) is an
+            /// epsilon state with up to two successors
+            struct State {
+                int set = -1;
+                int next = -1;
+                int alt = -1;
+            };
+
+            struct Frag {
+                int start;
+                int end;
+            };
+
+            struct Parser {
+                std::string_view pattern;
+                size_t pos = 0;
+                int depth = 0;
+                std::vector<Node> nodes;
+                std::vector<ByteSet> sets;
+
+                explicit Parser(std::string_view text) : pattern(text) {}
+
+                bool atEnd() const { return pos == pattern.size(); }
+                static bool isQuantifier(char c) { return c == '*' || c == '+' || c == '?' || c == '{'; }
+
+                int add(Node node) {
+                    nodes.push_back(std::move(node));
+                    return static_cast<int>(nodes.size()) - 1;
+                }
+
+                int addSet(const ByteSet& set) {
+                    sets.push_back(set);
+                    return add(Node{Node::Set, static_cast<int>(sets.size()) - 1, {}, 0, 0});
+                }
+
+                int parseAlt() {
+                    if (++depth > 256) return -1;
+                    std::vector<int> branches;
+                    for (;;) {
+                        int branch = parseConcat();
+                        if (branch < 0) return -1;
+                        branches.push_back(branch);
+                        if (atEnd() || pattern[pos] != '|') break;
+                        ++pos;
+                    }
+                    --depth;
+                    return branches.size() == 1 ? branches[0] : add(Node{Node::Alt, -1, std::move(branches), 0, 0});
+                }
+
+                int parseConcat() {
+                    std::vector<int> items;
+                    while (!atEnd() && pattern[pos] != '|' && pattern[pos] != ')') {
+                        char c = pattern[pos];
+                        if (c == '^' || c == '$') {
+                            // Under whole-string matching, anchors at the pattern's edges always hold
+                            if ((c == '^' && pos != 0) || (c == '$' && pos + 1 != pattern.size())) return -1;
+                            ++pos;
+                            if (!atEnd() && isQuantifier(pattern[pos])) return -1;
+                            continue;
+                        }
+                        int item = parseRepeat();
+                        if (item < 0) return -1;
+                        items.push_back(item);
+                    }
+                    return add(Node{Node::Concat, -1, std::move(items), 0, 0});
+                }
+
+                int parseRepeat() {
+                    int atom = parseAtom();
+                    if (atom < 0 || atEnd()) return atom;
+                    int min = 0, max = -1;
+                    switch (pattern[pos]) {
+                        case '*': ++pos; break;
+                        case '+': ++pos; min = 1; break;
+                        case '?': ++pos; max = 1; break;
+                        case '{': if (!parseBraces(min, max)) return -1; break;
+                        default: return atom;
+                    }
+                    if (!atEnd() && pattern[pos] == '?') ++pos; // lazy form matches the same strings
+                    if (!atEnd() && isQuantifier(pattern[pos])) return -1;
+                    return add(Node{Node::Repeat, -1, {atom}, min, max});
+                }
+
+                bool parseNumber(int& value) {
+                    size_t start = pos;
+                    value = 0;
+                    while (!atEnd() && pattern[pos] >= '0' && pattern[pos] <= '9' && pos - start < 4)
+                        value = value * 10 + (pattern[pos++] - '0');
+                    return pos > start && value <= 1000;
+                }
+
+                bool parseBraces(int& min, int& max) {
+                    ++pos;
+                    if (!parseNumber(min)) return false;
+                    max = min;
+                    if (!atEnd() && pattern[pos] == ',') {
+                        ++pos;
+                        max = -1;
+                        if (!atEnd() && pattern[pos] != '}' && !parseNumber(max)) return false;
+                    }
+                    if (atEnd() || pattern[pos] != '}' || (max >= 0 && max < min)) return false;
+                    ++pos;
+                    return true;
+                }
+
+                int parseAtom() {
+                    char c = pattern[pos];
+                    switch (c) {
+                        case '(': {
+                            ++pos;
+                            if (!atEnd() && pattern[pos] == '?') {
+                                if (pattern.substr(pos, 2) != "?:") return -1; // lookaround
+                                pos += 2;
+                            }
+                            int inner = parseAlt();
+                            if (inner < 0 || atEnd() || pattern[pos] != ')') return -1;
+                            ++pos;
+                            return inner;
+                        }
+                        case '[':
+                            return parseClass();
+                        case '.': {
+                            ++pos;
+                            ByteSet set;
+                            set.set();
+                            set.reset('\n');
+                            set.reset('\r');
+                            return addSet(set);
+                        }
+                        case '\\': {
+                            ++pos;
+                            ByteSet set;
+                            int single;
+                            if (!parseEscape(set, single)) return -1;
+                            return addSet(set);
+                        }
+                        case '*': case '+': case '?': case '{':
+                            return -1;
+                        default: {
+                            ++pos;
+                            ByteSet set;
+                            set.set(static_cast<unsigned char>(c));
+                            return addSet(set);
+                        }
+                    }
+                }
+
+                /// Parse the character after a backslash; single is the byte for one-byte escapes, else -1
+                bool parseEscape(ByteSet& set, int& single) {
+                    if (atEnd()) return false;
+                    char e = pattern[pos++];
+                    single = -1;
+                    auto addIf = [&set](auto pred, bool negate) {
+                        for (int b = 0; b < 256; ++b)
+                            if (pred(b) != negate) set.set(static_cast<size_t>(b));
+                    };
+                    auto digit = [](int b) { return b >= '0' && b <= '9'; };
+                    auto word = [](int b) { return (b >= '0' && b <= '9') || (b >= 'a' && b <= 'z') || (b >= 'A' && b <= 'Z') || b == '_'; };
+                    auto space = [](int b) { return b == ' ' || (b >= '\t' && b <= '\r'); };
+                    switch (e) {
+                        case 'd': addIf(digit, false); return true;
+                        case 'D': addIf(digit, true); return true;
+                        case 'w': addIf(word, false); return true;
+                        case 'W': addIf(word, true); return true;
+                        case 's': addIf(space, false); return true;
+                        case 'S': addIf(space, true); return true;
+                        case 't': single = '\t'; break;
+                        case 'n': single = '\n'; break;
+                        case 'r': single = '\r'; break;
+                        case 'f': single = '\f'; break;
+                        case 'v': single = '\v'; break;
+                        default:
+                            // \b, \B, backreferences, \x, \u, \c and other letter escapes are not supported
+                            if (std::isalnum(static_cast<unsigned char>(e))) return false;
+                            single = static_cast<unsigned char>(e);
+                    }
+                    set.set(static_cast<size_t>(single));
+                    return true;
+                }
+
+                bool parseClassAtom(ByteSet& set, int& single) {
+                    char c = pattern[pos];
+                    if (c == '\\') {
+                        ++pos;
+                        return parseEscape(set, single);
+                    }
+                    if (c == '[' && pos + 1 < pattern.size() &&
+                        (pattern[pos + 1] == ':' || pattern[pos + 1] == '=' || pattern[pos + 1] == '.'))
+                        return false; // POSIX classes
+                    ++pos;
+                    single = static_cast<unsigned char>(c);
+                    set.set(static_cast<size_t>(single));
+                    return true;
+                }
+
+                int parseClass() {
+                    ++pos;
+                    bool negate = !atEnd() && pattern[pos] == '^';
+                    if (negate) ++pos;
+                    if (atEnd() || pattern[pos] == ']') return -1;
+                    ByteSet set;
+                    while (!atEnd() && pattern[pos] != ']') {
+                        ByteSet low;
+                        int lo;
+                        if (!parseClassAtom(low, lo)) return -1;
+                        if (pos + 1 < pattern.size() && pattern[pos] == '-' && pattern[pos + 1] != ']') {
+                            ++pos;
+                            ByteSet high;
+                            int hi;
+                            if (!parseClassAtom(high, hi) || lo < 0 || hi < 0 || lo > hi) return -1;
+                            for (int b = lo; b <= hi; ++b) set.set(static_cast<size_t>(b));
+                        } else {
+                            set |= low;
+                        }
+                    }
+                    if (atEnd()) return -1;
+                    ++pos;
+                    if (negate) set.flip();
+                    return addSet(set);
+                }
+            };
+
+            int newState(int set = -1) {
+                m_states.push_back(State{set, -1, -1});
+                return static_cast<int>(m_states.size()) - 1;
+            }
+
+            State& at(int state) { return m_states[static_cast<size_t>(state)]; }
+
+            Frag emit(const std::vector<Node>& nodes, int id) {
+                if (m_states.size() > maxNfaStates) return {0, 0};
+                const Node& node = nodes[static_cast<size_t>(id)];
+                switch (node.kind) {
+                    case Node::Set: {
+                        int s = newState(node.set);
+                        int e = newState();
+                        at(s).next = e;
+                        return {s, e};
+                    }
+                    case Node::Concat: {
+                        int s = newState();
+                        Frag frag{s, s};
+                        for (int child : node.children) {
+                            Frag f = emit(nodes, child);
+                            at(frag.end).next = f.start;
+                            frag.end = f.end;
+                        }
+                        return frag;
+                    }
+                    case Node::Alt: {
+                        int split = newState();
+                        int e = newState();
+                        Frag frag{split, e};
+                        for (size_t i = 0; i < node.children.size(); ++i) {
+                            Frag f = emit(nodes, node.children[i]);
+                            at(f.end).next = e;
+                            at(split).next = f.start;
+                            if (i + 1 < node.children.size()) {
+                                int more = newState();
+                                at(split).alt = more;
+                                split = more;
+                            }
+                        }
+                        return frag;
+                    }
+                    case Node::Repeat: {
+                        int child = node.children[0];
+                        int s = newState();
+                        int cur = s;
+                        for (int i = 0; i < node.min; ++i) {
+                            Frag f = emit(nodes, child);
+                            at(cur).next = f.start;
+                            cur = f.end;
+                        }
+                        int e = newState();
+                        if (node.max < 0) {
+                            int loop = newState();
+                            Frag f = emit(nodes, child);
+                            at(cur).next = loop;
+                            at(loop).next = f.start;
+                            at(loop).alt = e;
+                            at(f.end).next = loop;
+                        } else {
+                            for (int i = node.min; i < node.max; ++i) {
+                                int split = newState();
+                                Frag f = emit(nodes, child);
+                                at(cur).next = split;
+                                at(split).next = f.start;
+                                at(split).alt = e;
+                                cur = f.end;
+                            }
+                            at(cur).next = e;
+                        }
+                        return {s, e};
+                    }
+                }
+                return {0, 0};
+            }
+
+            /// Add the byte-consuming states (and the accept state) reachable from state by epsilon moves
+            void closure(int state, std::vector<int>& out, std::vector<unsigned>& seen, unsigned generation,
+                         std::vector<int>& stack) const {
+                stack.push_back(state);
+                while (!stack.empty()) {
+                    int s = stack.back();
+                    stack.pop_back();
+                    if (s < 0 || seen[static_cast<size_t>(s)] == generation) continue;
+                    seen[static_cast<size_t>(s)] = generation;
+                    const State& st = m_states[static_cast<size_t>(s)];
+                    if (st.set >= 0 || s == m_accept) out.push_back(s);
+                    if (st.set < 0) {
+                        stack.push_back(st.alt);
+                        stack.push_back(st.next);
+                    }
+                }
+            }
+
+            void buildDfa() {
+                // Partition bytes into classes that every set treats alike, so the table is states x classes
+                std::map<std::vector<bool>, int> classIds;
+                std::vector<unsigned char> representative;
+                for (size_t b = 0; b < 256; ++b) {
+                    std::vector<bool> signature(m_sets.size());
+                    for (size_t k = 0; k < m_sets.size(); ++k) signature[k] = m_sets[k][b];
+                    auto inserted = classIds.emplace(std::move(signature), static_cast<int>(classIds.size()));
+                    if (inserted.second) representative.push_back(static_cast<unsigned char>(b));
+                    m_byteClass[b] = inserted.first->second;
+                }
+                m_classes = representative.size();
+
+                std::vector<unsigned> seen(m_states.size(), 0);
+                unsigned generation = 0;
+                std::vector<int> stack;
+                std::map<std::vector<int>, int> ids;
+                std::vector<std::vector<int>> pending;
+                std::vector<int> table;
+
+                auto intern = [&](std::vector<int> subset) {
+                    std::sort(subset.begin(), subset.end());
+                    auto found = ids.emplace(subset, static_cast<int>(pending.size()));
+                    if (found.second) {
+                        m_accepting.push_back(std::find(subset.begin(), subset.end(), m_accept) != subset.end());
+                        pending.push_back(std::move(subset));
+                    }
+                    return found.first->second;
+                };
+
+                std::vector<int> start;
+                closure(m_start, start, seen, ++generation, stack);
+                intern(std::move(start));
+                for (size_t d = 0; d < pending.size(); ++d) {
+                    if (pending.size() > maxDfaStates) {
+                        m_accepting.clear();
+                        return; // too large: match() simulates the NFA instead
+                    }
+                    for (size_t k = 0; k < m_classes; ++k) {
+                        std::vector<int> target;
+                        ++generation;
+                        for (int s : pending[d]) {
+                            const State& st = m_states[static_cast<size_t>(s)];
+                            if (st.set >= 0 && m_sets[static_cast<size_t>(st.set)][representative[k]])
+                                closure(st.next, target, seen, generation, stack);
+                        }
+                        table.push_back(target.empty() ? -1 : intern(std::move(target)));
+                    }
+                }
+                m_table = std::move(table);
             }
+
+            std::vector<State> m_states;
+            std::vector<ByteSet> m_sets;
+            int m_start = 0;
+            int m_accept = 0;
+            std::array<int, 256> m_byteClass{};
+            size_t m_classes = 0;
+            std::vector<int> m_table;      ///< DFA transitions, -1 for no match; empty when simulating the NFA
+            std::vector<char> m_accepting; ///< DFA accepting states
         };
+
+        /// @brief Get the automaton for a pattern, compiling it on first use.
+        /// Cached and shared like compiledRegex(). Returns nullptr if Automaton cannot represent the pattern.
+        inline std::shared_ptr<const Automaton> compiledAutomaton(const std::string& pattern) {
+            static std::mutex mutex;
+            static std::unordered_map<std::string, std::shared_ptr<const Automaton>> cache;
+            std::lock_guard<std::mutex> lock(mutex);
+            auto found = cache.find(pattern);
+            if (found == cache.end()) found = cache.emplace(pattern, Automaton::compile(pattern)).first;
+            return found->second;
+        }
     }
 
     /// @brief Returns a validator lambda that checks if a string value matches a regex pattern.
-    /// @param pattern Regex pattern to match against
+    /// @param pattern Regex pattern (ECMAScript syntax) that the whole value must match
     /// @return Lambda suitable for CliParser::setValidator() and CliParser::ArgBuilder::validate()
     /// This allows you to enforce that an argument's value must match a specific regex pattern.
+    /// Patterns within the subset described at detail::Automaton are matched in time linear in the
+    /// value's length; other patterns (backreferences, lookaround, ...) fall back to std::regex.
     inline auto IsMatch(const std::string& regexPattern) {
-        return [regexPattern](const std::string& name, const std::string& value) {
-            std::regex re(regexPattern);
-            if (!std::regex_match(value, re)) {
-                throw InvalidValueException("Value '" + value + "' for argument '" + name +
-                    "' does not match pattern: " + regexPattern);
+        // Compiled once here; every parse, on any thread, matches against the same automaton
+        std::shared_ptr<const detail::Automaton> automaton = detail::compiledAutomaton(regexPattern);
+        std::shared_ptr<const std::regex> re = automaton ? nullptr : detail::compiledRegex(regexPattern);
+        return [regexPattern, automaton, re](const std::string& name, const std::string& value) {
+            if (automaton ? !automaton->match(value) : !std::regex_match(value, *re)) {
+                ARGY_THROW(InvalidValueException("Value '" + value + "' for argument '" + name +
+                    "' does not match pattern: " + regexPattern));
             }
         };
     }
 
-    /// @brief Returns a validator lambda that checks if a string value is a valid IP address (IPv4 or IPv6).
+    /// @brief Binary form of an IPv4 address, in network byte order.
+    using IPv4Bytes = std::array<std::uint8_t, 4>;
+    /// @brief Binary form of an IPv6 address, in network byte order.
+    using IPv6Bytes = std::array<std::uint8_t, 16>;
+    /// @brief Binary form of a MAC address.
+    using MACBytes = std::array<std::uint8_t, 6>;
+    /// @brief Binary form of a UUID, in the order the hex digits are written.
+    using UUIDBytes = std::array<std::uint8_t, 16>;
+
+    namespace detail {
+        /// @brief Lookup table from byte to hex digit value, -1 for non-hex bytes.
+        struct HexTable {
+            signed char values[256];
+            constexpr HexTable() : values() {
+                for (int c = 0; c < 256; ++c) {
+                    values[c] = static_cast<signed char>(c >= '0' && c <= '9' ? c - '0'
+                                                       : c >= 'a' && c <= 'f' ? c - 'a' + 10
+                                                       : c >= 'A' && c <= 'F' ? c - 'A' + 10
+                                                       : -1);
+                }
+            }
+        };
+        inline constexpr HexTable hexTable{};
+
+        /// @brief Value of a hex digit, or -1 if the character is not one.
+        constexpr int hexValue(char c) { return hexTable.values[static_cast<unsigned char>(c)]; }
+
+        /// Locale-independent character classes used by the format parsers
+        constexpr bool isAsciiDigit(char c) { return c >= '0' && c <= '9'; }
+        constexpr bool isAsciiAlpha(char c) { return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z'); }
+        constexpr bool isHostChar(char c) { return isAsciiAlpha(c) || isAsciiDigit(c) || c == '.' || c == '-'; }
+        constexpr bool isEmailLocalChar(char c) {
+            return isAsciiAlpha(c) || isAsciiDigit(c) || c == '.' || c == '_' || c == '%' || c == '+' || c == '-';
+        }
+
+        /// @brief Check for an email address of the form local@domain.tld.
+        /// The local part uses letters, digits and ._%+-, the domain letters, digits, dots and dashes,
+        /// and the top-level domain at least two letters.
+        inline bool isEmail(std::string_view text) {
+            size_t at = text.find('@');
+            if (at == std::string_view::npos || at == 0) return false;
+            if (!std::all_of(text.begin(), text.begin() + at, isEmailLocalChar)) return false;
+            std::string_view domain = text.substr(at + 1);
+            size_t dot = domain.rfind('.');
+            if (dot == std::string_view::npos || dot == 0 || domain.size() - dot - 1 < 2) return false;
+            return std::all_of(domain.begin(), domain.begin() + dot, isHostChar) &&
+                   std::all_of(domain.begin() + dot + 1, domain.end(), isAsciiAlpha);
+        }
+
+        /// @brief Check for an http or https URL whose host has a top-level domain of two or more letters.
+        /// Anything after the host is accepted, except line breaks.
+        inline bool isUrl(std::string_view text) {
+            size_t begin;
+            if (text.substr(0, 7) == "http://") begin = 7;
+            else if (text.substr(0, 8) == "https://") begin = 8;
+            else return false;
+            size_t end = begin;
+            while (end < text.size() && isHostChar(text[end])) ++end;
+            bool hasDomain = false;
+            for (size_t i = begin + 1; i + 2 < end && !hasDomain; ++i) {
+                hasDomain = text[i] == '.' && isAsciiAlpha(text[i + 1]) && isAsciiAlpha(text[i + 2]);
+            }
+            return hasDomain && text.find_first_of("\r\n", end) == std::string_view::npos;
+        }
+    }
+
+    /// @brief Parse a dotted-quad IPv4 address such as "192.168.1.1".
+    /// Each octet is 0-255 written without leading zeros.
+    /// @param text Text to parse.
+    /// @return The four address bytes, or std::nullopt if text is not an IPv4 address.
+    inline std::optional<IPv4Bytes> parseIPv4(std::string_view text) {
+        IPv4Bytes bytes{};
+        size_t i = 0;
+        for (size_t octet = 0; octet < 4; ++octet) {
+            if (octet > 0) {
+                if (i == text.size() || text[i] != '.') return std::nullopt;
+                ++i;
+            }
+            size_t start = i;
+            unsigned value = 0;
+            while (i < text.size() && i - start < 3 && detail::isAsciiDigit(text[i])) {
+                value = value * 10 + static_cast<unsigned>(text[i++] - '0');
+            }
+            size_t digits = i - start;
+            if (digits == 0 || value > 255 || (digits > 1 && text[start] == '0')) return std::nullopt;
+            bytes[octet] = static_cast<std::uint8_t>(value);
+        }
+        if (i != text.size()) return std::nullopt;
+        return bytes;
+    }
+
+    /// @brief Parse an IPv6 address in any RFC 4291 text form.
+    /// Accepts the full eight-group form, "::" compression (e.g. "::1", "fe80::1") and a trailing
+    /// dotted-quad (e.g. "::ffff:192.0.2.1"). Zone identifiers ("%eth0") are not accepted.
+    /// @param text Text to parse.
+    /// @return The sixteen address bytes, or std::nullopt if text is not an IPv6 address.
+    inline std::optional<IPv6Bytes> parseIPv6(std::string_view text) {
+        std::uint16_t groups[8] = {};
+        size_t count = 0;
+        const size_t noGap = std::string_view::npos;
+        size_t gap = noGap; // group index where "::" was seen
+        size_t i = 0;
+        const size_t n = text.size();
+        if (n >= 2 && text[0] == ':' && text[1] == ':') {
+            gap = 0;
+            i = 2;
+        }
+        while (i < n) {
+            if (count == 8) return std::nullopt;
+            size_t start = i;
+            unsigned value = 0;
+            while (i < n && i - start < 4 && detail::hexValue(text[i]) >= 0) {
+                value = value * 16 + static_cast<unsigned>(detail::hexValue(text[i++]));
+            }
+            if (i == start) return std::nullopt;
+            if (i < n && text[i] == '.') {
+                // Trailing dotted-quad fills the last two groups
+                auto ipv4 = parseIPv4(text.substr(start));
+                if (!ipv4 || count > 6) return std::nullopt;
+                groups[count++] = static_cast<std::uint16_t>(((*ipv4)[0] << 8) | (*ipv4)[1]);
+                groups[count++] = static_cast<std::uint16_t>(((*ipv4)[2] << 8) | (*ipv4)[3]);
+                break;
+            }
+            groups[count++] = static_cast<std::uint16_t>(value);
+            if (i == n) break;
+            if (text[i] != ':' || ++i == n) return std::nullopt;
+            if (text[i] == ':') {
+                if (gap != noGap) return std::nullopt;
+                gap = count;
+                ++i;
+            }
+        }
+        if (gap == noGap ? count != 8 : count > 7) return std::nullopt;
+
+        IPv6Bytes bytes{};
+        size_t tail = count - std::min(gap, count);
+        for (size_t g = 0; g < count; ++g) {
+            size_t slot = g < gap ? g : 8 - tail + (g - gap);
+            bytes[slot * 2] = static_cast<std::uint8_t>(groups[g] >> 8);
+            bytes[slot * 2 + 1] = static_cast<std::uint8_t>(groups[g] & 0xFF);
+        }
+        return bytes;
+    }
+
+    /// @brief Parse a MAC address written as six hex pairs separated by ':' or '-'.
+    /// @param text Text to parse, e.g. "00:1A:2B:3C:4D:5E".
+    /// @return The six address bytes, or std::nullopt if text is not a MAC address.
+    inline std::optional<MACBytes> parseMACAddress(std::string_view text) {
+        if (text.size() != 17) return std::nullopt;
+        MACBytes bytes{};
+        int bad = 0;
+        for (size_t k = 0; k < 6; ++k) {
+            size_t pos = k * 3;
+            if (k > 0 && text[pos - 1] != ':' && text[pos - 1] != '-') return std::nullopt;
+            int hi = detail::hexValue(text[pos]);
+            int lo = detail::hexValue(text[pos + 1]);
+            bad |= hi | lo;
+            bytes[k] = static_cast<std::uint8_t>((hi << 4) | lo);
+        }
+        if (bad < 0) return std::nullopt;
+        return bytes;
+    }
+
+    /// @brief Parse a UUID in the 8-4-4-4-12 hex form, e.g. "123e4567-e89b-12d3-a456-426614174000".
+    /// Any version and variant is accepted.
+    /// @param text Text to parse.
+    /// @return The sixteen UUID bytes, or std::nullopt if text is not a UUID.
+    inline std::optional<UUIDBytes> parseUUID(std::string_view text) {
+        static constexpr unsigned char offsets[16] = {0, 2, 4, 6, 9, 11, 14, 16, 19, 21, 24, 26, 28, 30, 32, 34};
+        if (text.size() != 36 || text[8] != '-' || text[13] != '-' || text[18] != '-' || text[23] != '-')
+            return std::nullopt;
+        UUIDBytes bytes{};
+        // Fixed layout: decode all pairs unconditionally and test the accumulated error once
+        int bad = 0;
+        for (size_t k = 0; k < 16; ++k) {
+            int hi = detail::hexValue(text[offsets[k]]);
+            int lo = detail::hexValue(text[offsets[k] + 1]);
+            bad |= hi | lo;
+            bytes[k] = static_cast<std::uint8_t>((hi << 4) | lo);
+        }
+        if (bad < 0) return std::nullopt;
+        return bytes;
+    }
+
+    /// @brief Returns a validator lambda that checks if a string value is a valid IPv4 address.
     /// @return Lambda suitable for CliParser::setValidator() and CliParser::ArgBuilder::validate()
-    /// This allows you to enforce that an argument's value must be a valid IP address format.
+    /// This allows you to enforce that an argument's value must be a valid IPv4 address format.
     inline auto IsIPv4() {
-        return IsMatch(R"(\b((25[0-5]|2[0-4][0-9]|1[0-9]{2}|[1-9]?[0-9])\.){3}(25[0-5]|2[0-4][0-9]|1[0-9]{2}|[1-9]?[0-9])\b)");
+        return [](const std::string& name, const std::string& value) {
+            if (!parseIPv4(value)) {
+                ARGY_THROW(InvalidValueException("Value '" + value + "' for argument '" + name +
+                    "' is not a valid IPv4 address"));
+            }
+        };
     }
 
     /// @brief Returns a validator lambda that checks if a string value is a valid IPv6 address.
     /// @return Lambda suitable for CliParser::setValidator() and CliParser::ArgBuilder::validate()
     /// This allows you to enforce that an argument's value must be a valid IPv6 address format.
     inline auto IsIPv6() {
-        return IsMatch(R"(\b([0-9a-fA-F]{1,4}:){7}[0-9a-fA-F]{1,4}\b)");
+        return [](const std::string& name, const std::string& value) {
+            if (!parseIPv6(value)) {
+                ARGY_THROW(InvalidValueException("Value '" + value + "' for argument '" + name +
+                    "' is not a valid IPv6 address"));
+            }
+        };
     }
 
     /// @brief Returns a validator lambda that checks if a string value is a valid MAC address.
     /// @return Lambda suitable for CliParser::setValidator() and CliParser::ArgBuilder::validate()
     /// This allows you to enforce that an argument's value must be a valid MAC address format.
     inline auto IsMACAddress() {
-        return IsMatch(R"(\b([0-9A-Fa-f]{2}[:-]){5}([0-9A-Fa-f]{2})\b)");
+        return [](const std::string& name, const std::string& value) {
+            if (!parseMACAddress(value)) {
+                ARGY_THROW(InvalidValueException("Value '" + value + "' for argument '" + name +
+                    "' is not a valid MAC address"));
+            }
+        };
     }
 
     /// @brief Returns a validator lambda that checks if a string value is a valid IP address (IPv4 or IPv6).
@@ -297,15 +1034,9 @@ namespace Argy {
     /// This allows you to enforce that an argument's value must be a valid IP address format.
     inline auto IsIPAddress() {
         return [](const std::string& name, const std::string& value) {
-            try {
-                IsIPv4()(name, value);
-            } catch (const InvalidValueException&) {
-                try {
-                    IsIPv6()(name, value);
-                } catch (const InvalidValueException&) {
-                    throw InvalidValueException("Value '" + value + "' for argument '" + name +
-                        "' is not a valid IP address (IPv4 or IPv6)");
-                }
+            if (!parseIPv4(value) && !parseIPv6(value)) {
+                ARGY_THROW(InvalidValueException("Value '" + value + "' for argument '" + name +
+                    "' is not a valid IP address (IPv4 or IPv6)"));
             }
         };
     }
@@ -314,23 +1045,41 @@ namespace Argy {
     /// @return Lambda suitable for CliParser::setValidator() and CliParser::ArgBuilder::validate()
     /// This allows you to enforce that an argument's value must be a valid email address format.
     inline auto IsEmail() {
-        return IsMatch(R"(^[a-zA-Z0-9._%+-]+@[a-zA-Z0-9.-]+\.[a-zA-Z]{2,}$)");
+        return [](const std::string& name, const std::string& value) {
+            if (!detail::isEmail(value)) {
+                ARGY_THROW(InvalidValueException("Value '" + value + "' for argument '" + name +
+                    "' is not a valid email address"));
+            }
+        };
     }
      
     /// @brief Returns a validator lambda that checks if a string value is a valid URL.
     /// @return Lambda suitable for CliParser::setValidator() and CliParser::ArgBuilder::validate()
     /// This allows you to enforce that an argument's value must be a valid URL format.
     inline auto IsUrl() {
-        return IsMatch(R"(^https?://[a-zA-Z0-9.-]+(?:\.[a-zA-Z]{2,})+.*$)");
+        return [](const std::string& name, const std::string& value) {
+            if (!detail::isUrl(value)) {
+                ARGY_THROW(InvalidValueException("Value '" + value + "' for argument '" + name +
+                    "' is not a valid URL"));
+            }
+        };
     }
 
-    /// @brief Returns a validator lambda that checks if a string value is a valid UUID (version 4).
+    /// @brief Returns a validator lambda that checks if a string value is a valid UUID.
     /// @return Lambda suitable for CliParser::setValidator() and CliParser::ArgBuilder::validate()
     /// This allows you to enforce that an argument's value must be a valid UUID format.
     inline auto IsUUID() {
-        return IsMatch(R"(^[0-9a-fA-F]{8}-[0-9a-fA-F]{4}-[0-9a-fA-F]{4}-[0-9a-fA-F]{4}-[0-9a-fA-F]{12}$)");
+        return [](const std::string& name, const std::string& value) {
+            if (!parseUUID(value)) {
+                ARGY_THROW(InvalidValueException("Value '" + value + "' for argument '" + name +
+                    "' is not a valid UUID"));
+            }
+        };
     }
 
+    enum class ParseErrorCode;
+    class CliReader;
+
     /// @class CliData
     /// @brief Base class for argument storage (no public API)
     /// This class contains all the data structures and utility methods needed for argument management.
@@ -371,46 +1120,270 @@ namespace Argy {
             bool required{ true };  ///< True if argument must be provided by the user.
             ArgType type{ ArgType::String }; ///< Argument type.
             ArgValue defaultValue;     ///< Default value if any.
-            ArgValue parsedValue;     ///< Parsed value if any.
             bool positional{ false }; ///< True if this is a positional argument.
             std::function<void(const ArgValue&)> validator; ///< Optional value validator
+            size_t id{ 0 }; ///< Index of this argument's value in parse results.
+            std::function<void(void*, const ArgValue&)> target; ///< Copies a parsed value into a bound variable or struct member
+            const std::type_info* targetOwner{ nullptr }; ///< Struct type of a member binding, nullptr for a variable
+            std::function<ArgValue(const CliReader&)> defaultFn; ///< Computes the default on first read, if set
+            std::string defaultText; ///< How help describes a computed default
+        };
+
+        /// @struct ArgRecord
+        /// @brief The fields of an argument that parsing reads, packed for a dense scan.
+        /// Mirrors the matching ArgData fields; help text, names, defaults and callbacks stay in ArgData.
+        struct ArgRecord {
+            ArgType type{ ArgType::String }; ///< Argument type.
+            bool required{ true };    ///< True if argument must be provided by the user.
+            bool positional{ false }; ///< True if this is a positional argument.
+            bool validated{ false };  ///< True if ArgData::validator is set.
+            bool bound{ false };      ///< True if ArgData::target is set.
+            bool lazy{ false };       ///< True if conversion waits for the first read (see deferred()).
+            bool computedDefault{ false }; ///< True if ArgData::defaultFn is set.
+
+            /// @brief True if parsing keeps this argument's tokens unconverted; bound arguments never wait.
+            bool deferred() const { return lazy && !bound; }
+        };
+
+        /// @struct Schema
+        /// @brief All argument definitions, shared read-only by a parser and every result it produces.
+        /// Arguments are stored in declaration order and indexed by ArgData::id. The fields parsing needs
+        /// live in records, apart from the full definitions in arguments.
+        /// A schema is never modified once shared; CliBuilder copies it before changing a shared one.
+        /// Its containers allocate from one memory resource, and copies stay in that resource.
+        /// Strings held by the containers and by ArgData still use the global heap.
+        struct Schema {
+            std::pmr::unordered_map<std::string, size_t> nameLookup; ///< Maps argument names to ArgData::id.
+            std::pmr::vector<ArgRecord> records; ///< Parse-time fields of each argument, indexed by ArgData::id.
+            std::pmr::vector<ArgData> arguments; ///< Full definition of each argument, indexed by ArgData::id.
+            std::pmr::vector<size_t> positionalOrder; ///< Ids of positional arguments, in order.
+            std::pmr::vector<std::string> keys; ///< Canonical key of each argument, indexed by ArgData::id.
+            std::pmr::vector<ArgValue> defaults; ///< Default value of each argument, indexed by ArgData::id.
+
+            /// @brief Create an empty schema that allocates from the default memory resource.
+            Schema() = default;
+
+            /// @brief Create an empty schema that allocates from resource, which must outlive it.
+            explicit Schema(std::pmr::memory_resource* resource)
+                : nameLookup(resource), records(resource), arguments(resource), positionalOrder(resource), keys(resource),
+                  defaults(resource) {}
+
+            /// @brief Copy a schema into the memory resource of the original.
+            Schema(const Schema& other)
+                : nameLookup(other.nameLookup, other.resource()), records(other.records, other.resource()),
+                  arguments(other.arguments, other.resource()),
+                  positionalOrder(other.positionalOrder, other.resource()), keys(other.keys, other.resource()),
+                  defaults(other.defaults, other.resource()) {}
+
+            Schema& operator=(const Schema&) = default;
+
+            /// @brief Memory resource the containers allocate from.
+            std::pmr::memory_resource* resource() const { return keys.get_allocator().resource(); }
+
+            /// @brief Get an argument by its id.
+            const ArgData& at(size_t id) const { return arguments.at(id); }
+
+            /// @brief Find the id of an argument by a registered name in O(1).
+            /// @param name Argument name, normalized (no leading dashes) or in a registered dashed form.
+            /// @return The argument's ArgData::id, or npos if no argument has that name.
+            size_t findId(std::string_view name) const {
+                // std::unordered_map has no heterogeneous lookup before C++20. Reusing one key per thread
+                // keeps names longer than the small-string buffer from allocating on every lookup.
+                thread_local std::string key;
+                key.assign(name.data(), name.size());
+                auto lookupIt = nameLookup.find(key);
+                return lookupIt == nameLookup.end() ? npos : lookupIt->second;
+            }
+
+            /// @brief Find an argument by a registered name in O(1).
+            /// @param name Argument name, normalized (no leading dashes) or in a registered dashed form.
+            /// @return Pointer to the argument, or nullptr if no argument has that name.
+            const ArgData* find(std::string_view name) const {
+                size_t id = findId(name);
+                return id == npos ? nullptr : &arguments[id];
+            }
+
+            static constexpr size_t npos = static_cast<size_t>(-1); ///< findId() result for unknown names.
+        };
+
+        /// @struct Deferred
+        /// @brief Unconverted tokens of lazy arguments, shared by a parse result and its copies.
+        /// Each argument is converted and validated on its first read, under a lock, and the value is kept.
+        /// Tokens are copied here during parsing, so results never depend on the caller's token storage.
+        struct Deferred {
+            /// Converts tokens to a value of the given type; CliParser supplies its converter.
+            using Convert = ParseErrorCode (*)(ArgType, const std::string_view*, const std::string_view*, ArgValue&, size_t&);
+
+            /// Tokens of one argument as [begin, end) in tokens, and the index of the first one on the command line.
+            /// An absent argument with a computed default has computed set and no tokens.
+            struct Span {
+                bool provided{ false };
+                bool computed{ false };
+                size_t begin{ 0 };
+                size_t end{ 0 };
+                size_t tokenIndex{ 0 };
+            };
+
+            std::string text;                     ///< Copied tokens, back to back.
+            std::vector<std::string_view> tokens; ///< Views into text, grouped by argument.
+            std::vector<Span> spans;              ///< Tokens of each argument, indexed by ArgData::id.
+            std::vector<ArgValue> values;         ///< Converted values, indexed by ArgData::id.
+            std::unique_ptr<std::atomic<bool>[]> ready; ///< Whether values[id] holds the converted value.
+            std::recursive_mutex mutex;           ///< Serializes conversions; a computed default may read other arguments.
+            std::vector<size_t> resolving;        ///< Ids being resolved on the thread holding mutex, outermost first.
+            Convert convert{ nullptr };
+
+            /// @brief True if the argument waits for its first read: given and lazy, or absent with a computed default.
+            bool pending(size_t id) const { return id < spans.size() && (spans[id].provided || spans[id].computed); }
         };
 
     protected:
+        /// @brief One empty schema shared by every default-constructed object, so constructing one allocates nothing.
+        /// Being shared, it is copied by CliBuilder before the first argument is added, like any other schema.
+        static const std::shared_ptr<const Schema>& emptySchema() {
+            static const std::shared_ptr<const Schema> empty = std::make_shared<Schema>();
+            return empty;
+        }
+
         // Storage for arguments and metadata
-        std::unordered_map<std::string, std::string> m_nameLookup; ///< Maps argument names to canonical keys.
-        std::unordered_map<std::string, ArgData> m_arguments; ///< Map of all arguments.
-        std::vector<std::string> m_positionalOrder; ///< Order of positional arguments.
+        std::shared_ptr<const Schema> m_schema = emptySchema(); ///< Argument definitions (copy-on-write).
+        std::pmr::vector<ArgValue> m_values; ///< Parsed values indexed by ArgData::id; empty until parsed.
+        bool m_helpRequested = false; ///< True if parsing stopped at -h/--help.
+        std::shared_ptr<Deferred> m_deferred; ///< Tokens of lazy arguments, or nullptr if none were given.
         bool m_useColors = true; ///< Whether to use colors in help output
 
     public:
         /// @brief Default constructor
         CliData() = default;
         
-        /// @brief Copy constructor to enable copying of protected state
+        /// @brief Copy constructor; shares the schema and lazy tokens, and copies only the parsed values
+        /// The copied values use the default memory resource, so a copy outlives the resource of the original.
         /// @param other The CliData instance to copy from
         CliData(const CliData& other) = default;
 
+        /// @brief Move constructor; the values keep their memory resource
+        CliData(CliData&& other) = default;
+
+        CliData& operator=(const CliData& other) = default;
+
+        /// @brief Move assignment; like the move constructor, the values keep their memory resource.
+        /// Plain pmr move assignment would copy them into this object's resource whenever the two differ.
+        CliData& operator=(CliData&& other) noexcept {
+            if (this == &other) return *this;
+            m_schema = std::move(other.m_schema);
+            m_values.~vector();
+            new (&m_values) std::pmr::vector<ArgValue>(std::move(other.m_values));
+            m_helpRequested = other.m_helpRequested;
+            m_deferred = std::move(other.m_deferred);
+            m_useColors = other.m_useColors;
+            return *this;
+        }
+
+    protected:
+        /// @brief Hold values parsed against schema; values keep their memory resource.
+        CliData(std::shared_ptr<const Schema> schema, std::pmr::vector<ArgValue>&& values, bool helpRequested,
+                std::shared_ptr<Deferred> deferred = nullptr)
+            : m_schema(std::move(schema)), m_values(std::move(values)), m_helpRequested(helpRequested),
+              m_deferred(std::move(deferred)) {}
+
+    public:
+
+        /// @brief Get the argument definitions.
+        /// @return Shared, read-only schema; it stays valid and unchanged for as long as it is held.
+        std::shared_ptr<const Schema> schema() const { return m_schema; }
+
         /// @brief checks if a string starts with a given prefix
-        static bool startsWith(const std::string& str, const std::string& prefix) {
+        static bool startsWith(std::string_view str, std::string_view prefix) {
             return str.size() >= prefix.size() && str.compare(0, prefix.size(), prefix) == 0;
         }
 
-        /// @brief checks if a string represents a negative number
-        static bool isNegativeNumber(const std::string& str) {
-            if (!startsWith(str, "-") || str.size() <= 1) return false;
-            
-            // Check if the rest is a valid number (integer or float)
-            std::string numberPart = str.substr(1);
-            
-            // Try to parse as float (which also handles integers)
-            try {
-                auto num = std::stof(numberPart);
+        /// @brief Lexical kinds of command-line tokens.
+        enum class TokenKind {
+            LongFlag,       ///< --name
+            ShortFlag,      ///< -n
+            NegativeNumber, ///< -42, -3.5, -1e-3 (a value, not a flag)
+            Separator,      ///< -- on its own
+            Value           ///< Anything else, including a lone -
+        };
+
+        /// @brief Classify a token in a single pass, without allocating or throwing.
+        /// @param token The raw command-line token.
+        /// @return The token's lexical kind.
+        static TokenKind classifyToken(std::string_view token) {
+            if (token.size() < 2 || token[0] != '-') return TokenKind::Value;
+            if (token[1] == '-') return token.size() == 2 ? TokenKind::Separator : TokenKind::LongFlag;
+            return isNumberText(token.substr(1)) ? TokenKind::NegativeNumber : TokenKind::ShortFlag;
+        }
+
+        /// @brief Check whether text is an unsigned decimal number: digits with an optional fraction
+        /// and exponent (e.g. 42, 3.5, .5, 1e-3), or inf, infinity or nan in any case.
+        static bool isNumberText(std::string_view text) {
+            auto equalsNoCase = [](std::string_view a, std::string_view lower) {
+                if (a.size() != lower.size()) return false;
+                for (size_t k = 0; k < a.size(); ++k)
+                    if (std::tolower(static_cast<unsigned char>(a[k])) != lower[k]) return false;
                 return true;
-            } catch (const std::invalid_argument&) {
-                return false;
-            } catch (const std::out_of_range&) {
-                return false;
+            };
+            if (equalsNoCase(text, "inf") || equalsNoCase(text, "infinity") || equalsNoCase(text, "nan")) return true;
+            auto isDigit = [](char c) { return c >= '0' && c <= '9'; };
+            size_t k = 0, digits = 0;
+            while (k < text.size() && isDigit(text[k])) { ++k; ++digits; }
+            if (k < text.size() && text[k] == '.') {
+                ++k;
+                while (k < text.size() && isDigit(text[k])) { ++k; ++digits; }
+            }
+            if (digits == 0) return false;
+            if (k < text.size() && (text[k] == 'e' || text[k] == 'E')) {
+                ++k;
+                if (k < text.size() && (text[k] == '+' || text[k] == '-')) ++k;
+                size_t expDigits = 0;
+                while (k < text.size() && isDigit(text[k])) { ++k; ++expDigits; }
+                if (expDigits == 0) return false;
+            }
+            return k == text.size();
+        }
+
+        /// @brief checks if a string represents a negative number
+        static bool isNegativeNumber(std::string_view str) {
+            return classifyToken(str) == TokenKind::NegativeNumber;
+        }
+
+        /// @brief Convert a whole string to an int or float without exceptions or locale dependence.
+        /// @tparam T int or float.
+        /// @param str The text to convert; an optional sign followed by the number, nothing else.
+        /// @param out Receives the value on success.
+        /// @return std::errc{} on success, std::errc::invalid_argument if str is not entirely a number,
+        /// or std::errc::result_out_of_range if the number does not fit in T.
+        template<typename T>
+        static std::errc toNumber(std::string_view str, T& out) {
+            // from_chars rejects a leading '+', which std::stoi and std::stof accept
+            if (str.size() > 1 && str[0] == '+' && str[1] != '-') str.remove_prefix(1);
+            const char* first = str.data();
+            const char* last = str.data() + str.size();
+            if constexpr (std::is_same_v<T, int>) {
+                auto [ptr, ec] = std::from_chars(first, last, out);
+                if (ec == std::errc{} && ptr != last) return std::errc::invalid_argument;
+                return ec;
+            }
+            else {
+                static_assert(std::is_same_v<T, float>, "toNumber supports int and float");
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+                auto [ptr, ec] = std::from_chars(first, last, out);
+                if (ec == std::errc{} && ptr != last) return std::errc::invalid_argument;
+                return ec;
+#else
+                // Standard libraries without floating-point from_chars: a classic-locale stream
+                if (str.empty() || std::isspace(static_cast<unsigned char>(str[0]))) return std::errc::invalid_argument;
+                std::istringstream in{ std::string(str) };
+                in.imbue(std::locale::classic());
+                double value = 0.0;
+                in >> value;
+                if (in.fail() || in.peek() != std::char_traits<char>::eof()) return std::errc::invalid_argument;
+                if (value > std::numeric_limits<float>::max() || value < std::numeric_limits<float>::lowest())
+                    return std::errc::result_out_of_range;
+                out = static_cast<float>(value);
+                return std::errc{};
+#endif
             }
         }
 
@@ -508,6 +1481,134 @@ namespace Argy {
         }
     };
 
+    /// @brief Kinds of errors reported by CliParser::tryParse().
+    enum class ParseErrorCode {
+        None,                 ///< No error
+        UnknownArgument,      ///< A flag names no registered argument
+        UnexpectedPositional, ///< More positional values than positional arguments
+        MissingArgument,      ///< A required argument was not given
+        InvalidValue,         ///< A value could not be converted to the argument's type
+        OutOfRange,           ///< A numeric value does not fit in the argument's type
+        ValidationFailed      ///< A validator rejected the value
+    };
+
+    /// @struct ParseError
+    /// @brief A parse failure described by value; the message text is only built on request.
+    /// The error keeps its schema alive but only views the offending token, so it must not outlive the tokens.
+    struct ParseError {
+        static constexpr size_t npos = static_cast<size_t>(-1);
+
+        ParseErrorCode code{ ParseErrorCode::None }; ///< What went wrong.
+        size_t argId{ npos };       ///< ArgData::id of the argument involved, or npos.
+        size_t tokenIndex{ npos };  ///< Index of the offending token in the parsed tokens, or npos.
+        std::string_view token;     ///< The offending token, if any.
+        std::shared_ptr<const CliData::Schema> schema; ///< Schema the tokens were parsed against.
+        std::string detail;         ///< Validator message (ValidationFailed only).
+#ifndef ARGY_NO_EXCEPTIONS
+        std::exception_ptr exception; ///< Exception thrown by the validator (ValidationFailed only).
+#endif
+
+        /// @brief True if this describes an error.
+        explicit operator bool() const { return code != ParseErrorCode::None; }
+
+        /// @brief Build the human-readable error message.
+        std::string message() const {
+            const CliData::ArgData* arg = (schema && argId != npos) ? &schema->at(argId) : nullptr;
+            std::string name = arg ? (arg->names.empty() ? schema->keys[argId] : arg->names[0]) : std::string();
+            bool list = arg && CliData::isListType(arg->type);
+            switch (code) {
+            case ParseErrorCode::None:
+                return std::string();
+            case ParseErrorCode::UnknownArgument:
+                if (CliData::classifyToken(token) == CliData::TokenKind::LongFlag)
+                    return "Unknown argument: " + std::string(token);
+                return "Unknown short argument: " + std::string(token);
+            case ParseErrorCode::UnexpectedPositional:
+                return "Unexpected positional argument: " + std::string(token);
+            case ParseErrorCode::MissingArgument:
+                return (list ? "Missing required list argument: " : "Missing required argument: ") + name;
+            case ParseErrorCode::InvalidValue:
+                return (list ? "Invalid value in list for argument '" : "Invalid value for argument '") + name + "': " + std::string(token);
+            case ParseErrorCode::OutOfRange:
+                return (list ? "Value out of range in list for argument '" : "Value out of range for argument '") + name + "': " + std::string(token);
+            case ParseErrorCode::ValidationFailed:
+                return detail;
+            }
+            return std::string();
+        }
+
+        /// @brief Throw the exception that CliParser::parse() reports for this error.
+        [[noreturn]] void raise() const {
+            switch (code) {
+            case ParseErrorCode::UnknownArgument:
+                ARGY_THROW(UnknownArgumentException(message()));
+            case ParseErrorCode::UnexpectedPositional:
+                ARGY_THROW(UnexpectedPositionalArgumentException(message()));
+            case ParseErrorCode::MissingArgument:
+                ARGY_THROW(MissingArgumentException(message()));
+            case ParseErrorCode::OutOfRange:
+                // Out-of-range list elements have always been reported as invalid values
+                if (schema && argId != npos && CliData::isListType(schema->at(argId).type))
+                    ARGY_THROW(InvalidValueException(message()));
+                ARGY_THROW(OutOfRangeException(message()));
+            case ParseErrorCode::ValidationFailed:
+#ifndef ARGY_NO_EXCEPTIONS
+                if (exception) std::rethrow_exception(exception);
+#endif
+                ARGY_THROW(InvalidValueException(message()));
+            default:
+                ARGY_THROW(InvalidValueException(message()));
+            }
+        }
+    };
+
+    /// @class Arg
+    /// @brief Typed handle to one argument, returned by CliBuilder::add<T>() and the addX() helpers.
+    /// Reading through a handle indexes the parse result directly: no name normalization, no lookup,
+    /// no copy, and the value type is fixed at compile time.
+    /// A handle is only meaningful for the parser that created it and the results that parser produces.
+    template<typename T>
+    class Arg {
+    public:
+        /// @brief Create an empty handle; reading through it throws UnknownArgumentException.
+        Arg() = default;
+
+        /// @brief Create a handle for the argument with the given ArgData::id.
+        explicit Arg(size_t id) : m_id(id) {}
+
+        /// @brief Index of the argument's value in parse results.
+        size_t id() const { return m_id; }
+
+    private:
+        size_t m_id = static_cast<size_t>(-1);
+    };
+
+    /// @class ListView
+    /// @brief Read-only view of a list value stored elsewhere, as returned by ParseBuffer::get().
+    /// @tparam T Element type: int, float, bool or std::string_view.
+    template<typename T>
+    class ListView {
+    public:
+        /// @brief Create an empty view.
+        ListView() = default;
+
+        /// @brief View size elements starting at data.
+        ListView(const T* data, size_t size) : m_data(data), m_size(size) {}
+
+        const T* begin() const { return m_data; }          ///< First element.
+        const T* end() const { return m_data + m_size; }   ///< One past the last element.
+        const T* data() const { return m_data; }           ///< First element.
+        size_t size() const { return m_size; }             ///< Number of elements.
+        bool empty() const { return m_size == 0; }         ///< True if there are no elements.
+        const T& operator[](size_t i) const { return m_data[i]; } ///< Element i, unchecked.
+
+    private:
+        const T* m_data = nullptr;
+        size_t m_size = 0;
+    };
+
+    class ParseBuffer;
+
     /// @class CliReader
     /// @brief Read-only access to parsed command-line arguments
     /// This class provides methods to retrieve argument values after parsing.
@@ -522,6 +1623,31 @@ namespace Argy {
             // Base class copy constructor handles the copying
         }
 
+        CliReader(const CliReader& other) = default;
+        CliReader(CliReader&& other) = default;
+        CliReader& operator=(const CliReader& other) = default;
+
+        /// @brief Move assignment; the values keep their memory resource.
+        /// Written out because a defaulted one may assign the virtual base more than once.
+        CliReader& operator=(CliReader&& other) noexcept {
+            CliData::operator=(std::move(other));
+            return *this;
+        }
+
+        /// @brief Construct a result from a schema and the values parsed against it.
+        /// @param schema Argument definitions the values belong to.
+        /// @param values One value per argument, indexed by ArgData::id (empty if nothing was parsed).
+        /// The result keeps the values' memory resource, which must outlive it.
+        /// @param helpRequested True if parsing stopped at -h/--help.
+        /// @param deferred Tokens of lazy arguments whose slots in values are left empty, or nullptr.
+        CliReader(std::shared_ptr<const Schema> schema, std::pmr::vector<ArgValue> values, bool helpRequested = false,
+                  std::shared_ptr<Deferred> deferred = nullptr)
+            : CliData(std::move(schema), std::move(values), helpRequested, std::move(deferred)) {}
+
+        /// @brief Check whether parsing stopped because -h or --help was given.
+        /// @return True if help was requested; no values were parsed in that case.
+        bool helpRequested() const { return m_helpRequested; }
+
         /// @brief Get the parsed argument value by name.
         /// @tparam T Expected argument type.
         /// @param name Argument name.
@@ -530,50 +1656,74 @@ namespace Argy {
         /// @throws TypeMismatchException if the argument type does not match T.
         template<typename T>
         T get(const std::string& name) const {
-            std::string normName = normalizeName(name);
-            auto lookupIt = m_nameLookup.find(normName);
-            if (lookupIt == m_nameLookup.end()) throw UnknownArgumentException("Argument not found: " + name);
-            const ArgData& arg = m_arguments.at(lookupIt->second);
+            const ArgData* found = m_schema->find(normalizeName(name));
+            if (!found) ARGY_THROW(UnknownArgumentException("Argument not found: " + name));
+            const ArgData& arg = *found;
+            const ArgValue& parsedValue = valueOf(arg);
             // Special handling for bool: always optional, default is false if not present
             if constexpr (std::is_same_v<T, bool>) {
-                if (std::holds_alternative<bool>(arg.parsedValue)) {
-                    return std::get<bool>(arg.parsedValue);
+                if (std::holds_alternative<bool>(parsedValue)) {
+                    return std::get<bool>(parsedValue);
                 }
                 return false;
             }
             // Handle vector types
             if constexpr (is_vector<T>::value) {
-                if (std::holds_alternative<T>(arg.parsedValue)) {
-                    return std::get<T>(arg.parsedValue);
+                if (std::holds_alternative<T>(parsedValue)) {
+                    return std::get<T>(parsedValue);
                 }
                 else if (!std::holds_alternative<std::monostate>(arg.defaultValue) && std::holds_alternative<T>(arg.defaultValue)) {
                     return std::get<T>(arg.defaultValue);
                 }
-                throw TypeMismatchException("Type mismatch: argument '" + name + "' is not of type " + typeid(T).name() + ".");
+                ARGY_THROW(TypeMismatchException("Type mismatch: argument '" + name + "' is not of type " + typeid(T).name() + "."));
             }
             else {
-                if (std::holds_alternative<std::monostate>(arg.parsedValue)) {
+                if (std::holds_alternative<std::monostate>(parsedValue)) {
                     if (!std::holds_alternative<std::monostate>(arg.defaultValue) && std::holds_alternative<T>(arg.defaultValue)) {
                         return std::get<T>(arg.defaultValue);
                     }
-                    throw MissingArgumentException("Missing required argument: " + name);
+                    ARGY_THROW(MissingArgumentException("Missing required argument: " + name));
                 }
-                if (std::holds_alternative<T>(arg.parsedValue)) {
-                    return std::get<T>(arg.parsedValue);
+                if (std::holds_alternative<T>(parsedValue)) {
+                    return std::get<T>(parsedValue);
                 }
-                throw TypeMismatchException("Type mismatch: argument '" + name + "' is not of type " + typeid(T).name() + ".");
+                ARGY_THROW(TypeMismatchException("Type mismatch: argument '" + name + "' is not of type " + typeid(T).name() + "."));
+            }
+        }
+
+        /// @brief Get a parsed argument value through a typed handle.
+        /// @tparam T Argument type, fixed when the argument was added.
+        /// @param arg Handle returned by add<T>() or one of the addX() helpers.
+        /// @return Reference to the parsed value or, if it was not given, its default; valid as long as this object.
+        /// @throws UnknownArgumentException if the handle does not belong to this parser.
+        /// @throws MissingArgumentException if a required argument is read before it has been parsed.
+        /// @throws Argy::Exception subclasses from converting or validating a lazy argument on its first read.
+        template<typename T>
+        const T& get(const Arg<T>& arg) const {
+            if (arg.id() >= m_schema->defaults.size())
+                ARGY_THROW(UnknownArgumentException("Argument handle does not belong to this parser"));
+            if (const T* value = std::get_if<T>(&valueOf(arg.id()))) return *value;
+            if (const T* value = std::get_if<T>(&m_schema->defaults[arg.id()])) return *value;
+            if constexpr (std::is_same_v<T, bool>) {
+                static const bool absent = false;
+                return absent;
             }
+            ARGY_THROW(MissingArgumentException("Missing required argument: " + m_schema->keys[arg.id()]));
         }
 
+        /// @brief Get a parsed argument value through a typed handle; same as get(arg).
+        template<typename T>
+        const T& operator[](const Arg<T>& arg) const { return get(arg); }
+
         /// @brief Check if an argument was provided on the command line.
         /// @param name Argument name.
         /// @return True if the argument is present, false otherwise.
         bool has(const std::string& name) const {
-            std::string normName = normalizeName(name);
-            auto lookupIt = m_nameLookup.find(normName);
-            if (lookupIt == m_nameLookup.end()) return false;
-            const ArgData& arg = m_arguments.at(lookupIt->second);
-            return !std::holds_alternative<std::monostate>(arg.parsedValue);
+            const ArgData* arg = m_schema->find(normalizeName(name));
+            if (!arg) return false;
+            // A lazy argument that was given counts as present without being converted
+            if (m_deferred && m_deferred->pending(arg->id)) return true;
+            return !std::holds_alternative<std::monostate>(valueOf(*arg));
         }
 
         /// @name Convenience getters for specific types
@@ -588,6 +1738,66 @@ namespace Argy {
         std::vector<bool> getBools(const std::string& name) const { return get<std::vector<bool>>(name); }
         std::vector<std::string> getStrings(const std::string& name) const { return get<std::vector<std::string>>(name); }
         /// @}
+
+    private:
+        /// @brief Parsed value of an argument, or monostate if nothing has been parsed yet.
+        const ArgValue& valueOf(const ArgData& arg) const { return valueOf(arg.id); }
+
+        /// @brief Parsed value of the argument with the given id; lazy arguments are converted here.
+        const ArgValue& valueOf(size_t id) const {
+            static const ArgValue none;
+            if (id >= m_values.size()) return none;
+            if (m_deferred && m_deferred->pending(id)) return resolve(id);
+            return m_values[id];
+        }
+
+        /// @brief Convert and validate a lazy argument, or compute its default, once; later and concurrent
+        /// reads share the value.
+        /// @throws Argy::Exception subclasses, as parse() would have, or whatever a default function throws;
+        /// the next read tries again.
+        /// @throws InvalidArgumentException if computed defaults read each other in a cycle.
+        const ArgValue& resolve(size_t id) const {
+            Deferred& deferred = *m_deferred;
+            if (deferred.ready[id].load(std::memory_order_acquire)) return deferred.values[id];
+            std::lock_guard<std::recursive_mutex> lock(deferred.mutex);
+            if (deferred.ready[id].load(std::memory_order_relaxed)) return deferred.values[id];
+            // Only this thread can be resolving anything now, so seeing id again means a cycle
+            if (std::find(deferred.resolving.begin(), deferred.resolving.end(), id) != deferred.resolving.end()) {
+                std::string chain;
+                auto from = std::find(deferred.resolving.begin(), deferred.resolving.end(), id);
+                for (auto it = from; it != deferred.resolving.end(); ++it) chain += m_schema->keys[*it] + " -> ";
+                ARGY_THROW(InvalidArgumentException("Default values depend on each other: " + chain + m_schema->keys[id]));
+            }
+            deferred.resolving.push_back(id);
+            struct Pop {
+                std::vector<size_t>& ids;
+                ~Pop() { ids.pop_back(); }
+            } pop{ deferred.resolving };
+
+            const Deferred::Span& span = deferred.spans[id];
+            ArgValue value;
+            if (span.computed) {
+                value = m_schema->arguments[id].defaultFn(*this);
+            }
+            else {
+                const std::string_view* first = deferred.tokens.data() + span.begin;
+                size_t bad = 0;
+                ParseErrorCode code = deferred.convert(m_schema->records[id].type, first, deferred.tokens.data() + span.end, value, bad);
+                if (code != ParseErrorCode::None) {
+                    ParseError error;
+                    error.code = code;
+                    error.argId = id;
+                    error.tokenIndex = span.tokenIndex + bad;
+                    error.token = first[bad];
+                    error.schema = m_schema;
+                    error.raise();
+                }
+            }
+            if (m_schema->records[id].validated) m_schema->arguments[id].validator(value);
+            deferred.values[id] = std::move(value);
+            deferred.ready[id].store(true, std::memory_order_release);
+            return deferred.values[id];
+        }
     };
 
     /// @class CliBuilder
@@ -595,6 +1805,18 @@ namespace Argy {
     /// This class allows adding arguments and setting validators.
     class CliBuilder : public virtual CliData {
     public:
+        CliBuilder() = default;
+        CliBuilder(const CliBuilder& other) = default;
+        CliBuilder(CliBuilder&& other) = default;
+        CliBuilder& operator=(const CliBuilder& other) = default;
+
+        /// @brief Move assignment; written out because a defaulted one may assign the virtual base more than once.
+        CliBuilder& operator=(CliBuilder&& other) noexcept {
+            CliData::operator=(std::move(other));
+            m_revision = other.m_revision;
+            return *this;
+        }
+
         /// Helper to deduce lambda argument types
         template<typename T>
         struct lambda_arg_type;
@@ -617,13 +1839,22 @@ namespace Argy {
 
         /// @brief ArgBuilder class for adding additional functionality to argument definitions.
         /// This class allows you to chain validation functions to an argument after it has been defined.
+        /// @tparam ValueT Type of the argument's value; the builder converts to a typed Arg<ValueT> handle.
+        template<typename ValueT>
         class ArgBuilder {
         public:
             /// @brief Constructs an ArgBuilder for a specific argument key.
             /// @param setter Reference to the CliBuilder instance.
             /// @param key The argument key (name) to build upon.
-            ArgBuilder(CliBuilder& setter, const std::string& key)
-                : m_setter(setter), m_key(key) {}
+            /// @param id The argument's ArgData::id.
+            ArgBuilder(CliBuilder& setter, const std::string& key, size_t id)
+                : m_setter(setter), m_key(key), m_id(id) {}
+
+            /// @brief Get a typed handle for reading this argument from parse results.
+            Arg<ValueT> handle() const { return Arg<ValueT>(m_id); }
+
+            /// @brief Convert to a typed handle, so `Arg<int> n = cli.addInt(...).isInRange(1, 9);` works.
+            operator Arg<ValueT>() const { return handle(); }
 
             /// @brief Adds a validation function to the argument.
             template<typename F>
@@ -667,6 +1898,35 @@ namespace Argy {
             ArgBuilder& isUrl() { return validate(IsUrl()); }
             ArgBuilder& isUUID() { return validate(IsUUID()); }
 
+            /// @brief Convert and validate this argument on its first read instead of during parsing.
+            /// parse() keeps a copy of the raw tokens; the first get() converts them, runs the validators
+            /// and keeps the value for later reads, from any thread. A bad value is then reported by that
+            /// get() rather than by parse(). Bound arguments and ParseBuffer still convert while parsing.
+            ArgBuilder& lazy() {
+                m_setter.setLazy(m_id);
+                return *this;
+            }
+
+            /// @brief Compute the default when the argument is absent, on its first read.
+            /// The argument becomes optional. fn runs at most once per parse result, and only if the
+            /// argument was not given and is read; its value is validated like a parsed one. fn may take the
+            /// result being read and read other arguments from it, including ones with computed defaults.
+            /// A cycle among those reads throws InvalidArgumentException. Help shows description instead of
+            /// calling fn. ParseBuffer does not call fn and reads such an absent argument as missing.
+            /// @param description Text help shows as the default, e.g. "number of CPUs".
+            /// @param fn Callable returning the value, taking no arguments or a const CliReader&.
+            /// @throws InvalidArgumentException if the argument is bound to a variable or member.
+            template<typename F>
+            ArgBuilder& defaultTo(const std::string& description, F fn) {
+                std::function<ArgValue(const CliReader&)> compute;
+                if constexpr (std::is_invocable_v<F, const CliReader&>)
+                    compute = [fn = std::move(fn)](const CliReader& args) { return ArgValue(ValueT(fn(args))); };
+                else
+                    compute = [fn = std::move(fn)](const CliReader&) { return ArgValue(ValueT(fn())); };
+                m_setter.setDefaultFn(m_id, description, std::move(compute));
+                return *this;
+            }
+
             /// @brief Sets a default value for the argument.
             /// @returns a reference to the CliBuilder for further chaining.
             CliBuilder& done() { return m_setter; }
@@ -674,6 +1934,7 @@ namespace Argy {
         private:
             CliBuilder& m_setter;
             std::string m_key;
+            size_t m_id;
         };
         /// @brief set validator for an argument
         /// @param name Argument name to set the validator for.
@@ -681,19 +1942,21 @@ namespace Argy {
         /// This allows you to enforce custom validation rules for argument values.
         template<typename F>
         void setValidator(const std::string& name, F&& fn) {
-            auto lookupIt = m_nameLookup.find(normalizeName(name));
-            if (lookupIt == m_nameLookup.end())
-                throw UnknownArgumentException("Argument not found for validator: " + name);
-            auto& arg = m_arguments.at(lookupIt->second);
+            Schema& schema = mutableSchema();
+            auto lookupIt = schema.nameLookup.find(normalizeName(name));
+            if (lookupIt == schema.nameLookup.end())
+                ARGY_THROW(UnknownArgumentException("Argument not found for validator: " + name));
+            auto& arg = schema.arguments[lookupIt->second];
+            schema.records[arg.id].validated = true;
             using T = lambda_arg_t<F>;
             arg.validator = [fn = std::forward<F>(fn), name](const ArgValue& v) {
                 if constexpr (std::is_invocable_v<F, T>) {
                     if (!std::holds_alternative<T>(v))
-                        throw TypeMismatchException("Validator type mismatch for argument '" + name + "'");
+                        ARGY_THROW(TypeMismatchException("Validator type mismatch for argument '" + name + "'"));
                     fn(std::get<T>(v));
                 } else if constexpr (std::is_invocable_v<F, std::string, T>) {
                     if (!std::holds_alternative<T>(v))
-                        throw TypeMismatchException("Validator type mismatch for argument '" + name + "'");
+                        ARGY_THROW(TypeMismatchException("Validator type mismatch for argument '" + name + "'"));
                     fn(name, std::get<T>(v));
                 } else {
                     static_assert(std::is_invocable_v<F, T> || std::is_invocable_v<F, std::string, T>,
@@ -708,7 +1971,7 @@ namespace Argy {
         /// @param help Help text for usage.
         /// @param defaultValue Optional default value; if omitted, argument is required.
         template<typename T>
-        ArgBuilder add(const char* name, const char* help, std::optional<T> defaultValue = std::nullopt) {
+        ArgBuilder<T> add(const char* name, const char* help, std::optional<T> defaultValue = std::nullopt) {
             return add<T>(std::vector<std::string>{std::string(name)}, help, defaultValue);
         }
 
@@ -718,18 +1981,18 @@ namespace Argy {
         /// @param help Help text for usage.
         /// @param defaultValue Optional default value; if omitted, argument is required.
         template<typename T>
-        ArgBuilder add(const std::vector<std::string>& names, const std::string& help, std::optional<T> defaultValue = std::nullopt) {
+        ArgBuilder<T> add(const std::vector<std::string>& names, const std::string& help, std::optional<T> defaultValue = std::nullopt) {
             std::vector<std::string> cleanNames;
             bool isPositional = true;
             std::vector<std::string> shortNames, longNames;
             for (const auto& n : names) {
                 if (startsWith(n, "--")) {
-                    if (n.size() <= 2) throw InvalidArgumentException("longName must not be empty after --");
+                    if (n.size() <= 2) ARGY_THROW(InvalidArgumentException("longName must not be empty after --"));
                     longNames.push_back(n.substr(2));
                     isPositional = false;
                 }
                 else if (startsWith(n, "-")) {
-                    if (n.size() <= 1) throw InvalidArgumentException("shortName must not be empty after -");
+                    if (n.size() <= 1) ARGY_THROW(InvalidArgumentException("shortName must not be empty after -"));
                     shortNames.push_back(n.substr(1));
                     isPositional = false;
                 }
@@ -741,19 +2004,16 @@ namespace Argy {
 
             // Prevent overriding help flags
             for (const auto& ln : longNames) {
-                if (ln == "help") throw ReservedArgumentException("Cannot redefine built-in --help argument");
+                if (ln == "help") ARGY_THROW(ReservedArgumentException("Cannot redefine built-in --help argument"));
             }
             for (const auto& sn : shortNames) {
-                if (sn == "h") throw ReservedArgumentException("Cannot redefine built-in -h argument");
+                if (sn == "h") ARGY_THROW(ReservedArgumentException("Cannot redefine built-in -h argument"));
             }
 
-            // Check for duplicates across all existing aliases
-            for (const auto& [k, v] : m_arguments) {
-                for (const auto& existing : v.names) {
-                    for (const auto& cand : cleanNames) {
-                        if (existing == cand) throw DuplicateArgumentException("Duplicate argument name: " + cand);
-                    }
-                }
+            Schema& schema = mutableSchema();
+            // Check for duplicates through the name index: O(aliases), not O(arguments)
+            for (const auto& cand : cleanNames) {
+                if (schema.nameLookup.count(cand)) ARGY_THROW(DuplicateArgumentException("Duplicate argument name: " + cand));
             }
             ArgType type = deduceArgType<T>();
             ArgValue val = defaultValue ? ArgValue(*defaultValue) : ArgValue{};
@@ -762,81 +2022,204 @@ namespace Argy {
             // Use first provided normalized name as canonical key
             std::string key = cleanNames.empty() ? std::string() : cleanNames[0];
             // Store aliases (normalized names) and original classification
-            ArgData arg{ cleanNames, shortNames, longNames, help, isRequired, type, val, ArgValue{}, isPositional };
-            m_arguments[key] = arg;
+            // Fields set one by one, so those added to ArgData later keep their defaults without warnings
+            ArgData arg;
+            arg.names = cleanNames;
+            arg.shortForms = shortNames;
+            arg.longForms = longNames;
+            arg.help = help;
+            arg.required = isRequired;
+            arg.type = type;
+            arg.defaultValue = val;
+            arg.positional = isPositional;
+            arg.id = schema.arguments.size();
+            schema.arguments.push_back(arg);
+            schema.records.push_back(ArgRecord{ type, isRequired, isPositional });
+            schema.keys.push_back(key);
+            schema.defaults.push_back(val);
             // Register all forms in lookup map
             for (const auto& cn : cleanNames) {
-                m_nameLookup[cn] = key;
+                schema.nameLookup[cn] = arg.id;
             }
             // Also register dashed forms for display/lookup convenience
             for (const auto& ln : longNames) {
-                m_nameLookup[ln] = key;
-                m_nameLookup["--" + ln] = key;
+                schema.nameLookup[ln] = arg.id;
+                schema.nameLookup["--" + ln] = arg.id;
             }
             for (const auto& sn : shortNames) {
-                m_nameLookup[sn] = key;
-                m_nameLookup["-" + sn] = key;
+                schema.nameLookup[sn] = arg.id;
+                schema.nameLookup["-" + sn] = arg.id;
             }
             if (isPositional) {
-                m_positionalOrder.push_back(key);
+                schema.positionalOrder.push_back(arg.id);
             }
-            return ArgBuilder(*this, key);
+            return ArgBuilder<T>(*this, key, arg.id);
         }
 
-        // Convenience overloads for single name
-        ArgBuilder addString(const char* name, const std::string& help, std::optional<std::string> defaultValue = std::nullopt) {
+        /// @brief Add an argument whose value parse() writes into a variable.
+        /// @param name Argument name (e.g. "-t", "--threads").
+        /// @param help Help text for usage.
+        /// @param target Variable to write to. Its current value is the default. It must outlive the parser.
+        /// The value is copied into the variable after validation and stays readable in the parse result.
+        template<typename P, typename T = std::remove_pointer_t<P>,
+                 std::enable_if_t<std::is_pointer_v<P> && !std::is_const_v<T>, int> = 0>
+        ArgBuilder<T> add(const char* name, const std::string& help, P target) {
+            return add(std::vector<std::string>{std::string(name)}, help, target);
+        }
+
+        /// @brief Add an argument whose value parse() writes into a variable.
+        /// @param names Vector of argument names (e.g. {"-t", "--threads"}).
+        /// @param help Help text for usage.
+        /// @param target Variable to write to. Its current value is the default. It must outlive the parser.
+        /// The value is copied into the variable after validation and stays readable in the parse result.
+        template<typename P, typename T = std::remove_pointer_t<P>,
+                 std::enable_if_t<std::is_pointer_v<P> && !std::is_const_v<T>, int> = 0>
+        ArgBuilder<T> add(const std::vector<std::string>& names, const std::string& help, P target) {
+            ArgBuilder<T> builder = add<T>(names, help, std::optional<T>(*target));
+            bindTarget(builder.handle().id(), nullptr, [target](void*, const ArgValue& value) {
+                *target = std::get<T>(value);
+            });
+            return builder;
+        }
+
+        /// @brief Add an argument whose value CliParser::parseInto() writes into a struct member.
+        /// @param name Argument name (e.g. "-t", "--threads").
+        /// @param help Help text for usage.
+        /// @param member Member to write to, e.g. &Options::threads.
+        /// @param defaultValue Optional default value; if omitted, argument is required.
+        template<typename S, typename T>
+        ArgBuilder<T> add(const char* name, const std::string& help, T S::* member,
+                          std::optional<typename detail::type_identity<T>::type> defaultValue = std::nullopt) {
+            return add(std::vector<std::string>{std::string(name)}, help, member, std::move(defaultValue));
+        }
+
+        /// @brief Add an argument whose value CliParser::parseInto() writes into a struct member.
+        /// @param names Vector of argument names (e.g. {"-t", "--threads"}).
+        /// @param help Help text for usage.
+        /// @param member Member to write to, e.g. &Options::threads.
+        /// @param defaultValue Optional default value; if omitted, argument is required.
+        /// The schema records only the member, so one parser can fill any number of structs, from any thread.
+        template<typename S, typename T>
+        ArgBuilder<T> add(const std::vector<std::string>& names, const std::string& help, T S::* member,
+                          std::optional<typename detail::type_identity<T>::type> defaultValue = std::nullopt) {
+            ArgBuilder<T> builder = add<T>(names, help, std::move(defaultValue));
+            bindTarget(builder.handle().id(), &typeid(S), [member](void* object, const ArgValue& value) {
+                static_cast<S*>(object)->*member = std::get<T>(value);
+            });
+            return builder;
+        }
+
+        // Convenience overloads for single name
+        ArgBuilder<std::string> addString(const char* name, const std::string& help, std::optional<std::string> defaultValue = std::nullopt) {
             return add<std::string>(std::vector<std::string>{std::string(name)}, help, defaultValue);
         }
-        ArgBuilder addInt(const char* name, const std::string& help, std::optional<int> defaultValue = std::nullopt) {
+        ArgBuilder<int> addInt(const char* name, const std::string& help, std::optional<int> defaultValue = std::nullopt) {
             return add<int>(std::vector<std::string>{std::string(name)}, help, defaultValue);
         }
-        ArgBuilder addFloat(const char* name, const std::string& help, std::optional<float> defaultValue = std::nullopt) {
+        ArgBuilder<float> addFloat(const char* name, const std::string& help, std::optional<float> defaultValue = std::nullopt) {
             return add<float>(std::vector<std::string>{std::string(name)}, help, defaultValue);
         }
-        ArgBuilder addBool(const char* name, const std::string& help, std::optional<bool> defaultValue = false) {
+        ArgBuilder<bool> addBool(const char* name, const std::string& help, std::optional<bool> defaultValue = false) {
             return add<bool>(std::vector<std::string>{std::string(name)}, help, defaultValue);
         }
-        ArgBuilder addStrings(const char* name, const std::string& help, std::optional<std::vector<std::string>> defaultValue = std::nullopt) {
+        ArgBuilder<std::vector<std::string>> addStrings(const char* name, const std::string& help, std::optional<std::vector<std::string>> defaultValue = std::nullopt) {
             return add<std::vector<std::string>>(std::vector<std::string>{std::string(name)}, help, defaultValue);
         }
-        ArgBuilder addInts(const char* name, const std::string& help, std::optional<std::vector<int>> defaultValue = std::nullopt) {
+        ArgBuilder<std::vector<int>> addInts(const char* name, const std::string& help, std::optional<std::vector<int>> defaultValue = std::nullopt) {
             return add<std::vector<int>>(std::vector<std::string>{std::string(name)}, help, defaultValue);
         }
-        ArgBuilder addFloats(const char* name, const std::string& help, std::optional<std::vector<float>> defaultValue = std::nullopt) {
+        ArgBuilder<std::vector<float>> addFloats(const char* name, const std::string& help, std::optional<std::vector<float>> defaultValue = std::nullopt) {
             return add<std::vector<float>>(std::vector<std::string>{std::string(name)}, help, defaultValue);
         }
-        ArgBuilder addBools(const char* name, const std::string& help, std::optional<std::vector<bool>> defaultValue = std::nullopt) {
+        ArgBuilder<std::vector<bool>> addBools(const char* name, const std::string& help, std::optional<std::vector<bool>> defaultValue = std::nullopt) {
             return add<std::vector<bool>>(std::vector<std::string>{std::string(name)}, help, defaultValue);
         }
         // Convenience methods for adding arguments of specific types using vector<string> API
-        ArgBuilder addString(const std::vector<std::string>& names, const std::string& help, std::optional<std::string> defaultValue = std::nullopt) {
+        ArgBuilder<std::string> addString(const std::vector<std::string>& names, const std::string& help, std::optional<std::string> defaultValue = std::nullopt) {
             return add<std::string>(names, help, defaultValue);
         }
-        ArgBuilder addInt(const std::vector<std::string>& names, const std::string& help, std::optional<int> defaultValue = std::nullopt) {
+        ArgBuilder<int> addInt(const std::vector<std::string>& names, const std::string& help, std::optional<int> defaultValue = std::nullopt) {
             return add<int>(names, help, defaultValue);
         }
-        ArgBuilder addFloat(const std::vector<std::string>& names, const std::string& help, std::optional<float> defaultValue = std::nullopt) {
+        ArgBuilder<float> addFloat(const std::vector<std::string>& names, const std::string& help, std::optional<float> defaultValue = std::nullopt) {
             return add<float>(names, help, defaultValue);
         }
-        ArgBuilder addBool(const std::vector<std::string>& names, const std::string& help, std::optional<bool> defaultValue = false) {
+        ArgBuilder<bool> addBool(const std::vector<std::string>& names, const std::string& help, std::optional<bool> defaultValue = false) {
             return add<bool>(names, help, defaultValue);
         }
-        ArgBuilder addStrings(const std::vector<std::string>& names, const std::string& help, std::optional<std::vector<std::string>> defaultValue = std::nullopt) {
+        ArgBuilder<std::vector<std::string>> addStrings(const std::vector<std::string>& names, const std::string& help, std::optional<std::vector<std::string>> defaultValue = std::nullopt) {
             return add<std::vector<std::string>>(names, help, defaultValue);
         }
-        ArgBuilder addInts(const std::vector<std::string>& names, const std::string& help, std::optional<std::vector<int>> defaultValue = std::nullopt) {
+        ArgBuilder<std::vector<int>> addInts(const std::vector<std::string>& names, const std::string& help, std::optional<std::vector<int>> defaultValue = std::nullopt) {
             return add<std::vector<int>>(names, help, defaultValue);
         }
-        ArgBuilder addFloats(const std::vector<std::string>& names, const std::string& help, std::optional<std::vector<float>> defaultValue = std::nullopt) {
+        ArgBuilder<std::vector<float>> addFloats(const std::vector<std::string>& names, const std::string& help, std::optional<std::vector<float>> defaultValue = std::nullopt) {
             return add<std::vector<float>>(names, help, defaultValue);
         }
-        ArgBuilder addBools(const std::vector<std::string>& names, const std::string& help, std::optional<std::vector<bool>> defaultValue = std::nullopt) {
+        ArgBuilder<std::vector<bool>> addBools(const std::vector<std::string>& names, const std::string& help, std::optional<std::vector<bool>> defaultValue = std::nullopt) {
             return add<std::vector<bool>>(names, help, defaultValue);
         }
+
+    private:
+        /// @brief Record where parse() should write an argument's value.
+        void bindTarget(size_t id, const std::type_info* owner, std::function<void(void*, const ArgValue&)> target) {
+            Schema& schema = mutableSchema();
+            ArgData& arg = schema.arguments[id];
+            schema.records[id].bound = true;
+            arg.target = std::move(target);
+            arg.targetOwner = owner;
+        }
+
+        /// @brief Replace an argument's default with one computed on first read.
+        void setDefaultFn(size_t id, const std::string& description, std::function<ArgValue(const CliReader&)> fn) {
+            Schema& schema = mutableSchema();
+            ArgRecord& record = schema.records[id];
+            if (record.bound)
+                ARGY_THROW(InvalidArgumentException("A bound argument cannot compute its default: " + schema.keys[id]));
+            ArgData& arg = schema.arguments[id];
+            arg.defaultFn = std::move(fn);
+            arg.defaultText = description;
+            arg.defaultValue = std::monostate{};
+            arg.required = record.required = false;
+            record.computedDefault = true;
+            schema.defaults[id] = std::monostate{};
+        }
+
+        /// @brief Mark an argument for conversion on first read.
+        void setLazy(size_t id) {
+            mutableSchema().records[id].lazy = true;
+        }
+
+        /// @brief Get the schema for modification, copying it first if parse results still share it.
+        Schema& mutableSchema() {
+            ++m_revision;
+            if (m_schema.use_count() > 1)
+                m_schema = std::allocate_shared<Schema>(std::pmr::polymorphic_allocator<Schema>(m_schema->resource()), *m_schema);
+            // Every schema is created non-const by this class and is no longer shared here
+            return const_cast<Schema&>(*m_schema);
+        }
+
+    protected:
+        uint64_t m_revision = 0; ///< Bumped on every change to the schema or to help settings.
     };
 
     using ParsedArgs = CliReader; ///< Alias for read-only parsed arguments
 
+    /// @struct ParseResult
+    /// @brief Outcome of parsing one command line without exceptions.
+    struct ParseResult {
+        ParsedArgs args;   ///< Parsed arguments; empty if parsing failed.
+        ParseError error;  ///< What went wrong, if anything.
+
+        /// @brief Check whether the command line parsed and validated successfully.
+        bool ok() const { return !error; }
+
+        /// @brief Get the error message, or an empty string on success.
+        std::string message() const { return error.message(); }
+    };
+
+    using BatchResult = ParseResult; ///< Outcome of parsing one command line of a batch
+
     /// @class CliParser
     /// @brief Main class for building and parsing command-line arguments
     class CliParser : public CliBuilder, public CliReader {
@@ -845,398 +2228,1807 @@ namespace Argy {
         /// @param argc Argument count from main().
         /// @param argv Argument vector from main().
         /// @param useColors Whether to use ANSI color codes in help output (default: true).
-        explicit CliParser(int argc, char* argv[], bool useColors = true)
+        /// @param resource Memory resource for the schema's containers; it must outlive the parser,
+        /// every schema() handle and every result. A std::pmr::monotonic_buffer_resource keeps the
+        /// whole schema in a few contiguous blocks and frees it in one step.
+        explicit CliParser(int argc, char* argv[], bool useColors = true,
+                           std::pmr::memory_resource* resource = std::pmr::get_default_resource())
             : m_argc(argc), m_argv(argv) {
             m_useColors = useColors;
-            m_helpHandler = [this](std::string name) {
-                printHelp(name);
-                std::exit(0);
-            };
+            if (resource != m_schema->resource())
+                m_schema = std::allocate_shared<Schema>(std::pmr::polymorphic_allocator<Schema>(resource), resource);
         }
 
+        CliParser(const CliParser& other) = default;
+        CliParser(CliParser&& other) = default;
+        CliParser& operator=(const CliParser& other) = default;
+
+        /// @brief Move assignment copies: moving through both bases would move the shared CliData twice.
+        CliParser& operator=(CliParser&& other) { return *this = static_cast<const CliParser&>(other); }
+
         /// @brief Set a custom help handler invoked on --help or -h.
         /// @param handler Function to call when help is requested. Receives the program name.
-        /// The default handler prints help and exits. Override this if you want to return or throw instead.
+        /// Without a handler, help is printed and the program exits. Set one if you want to return or throw instead.
+        /// A handler can get a search term such as "--help color" from helpQuery().
         void setHelpHandler(std::function<void(std::string)> handler) {
             m_helpHandler = std::move(handler);
         }
 
-        void setHelpHeader(const std::string& header) { m_header = header; }
-        void setHelpFooter(const std::string& footer) { m_footer = footer; }
-        void setHelpDescription(const std::string& description) { m_description = description; }
+        void setHelpHeader(const std::string& header) { m_header = header; ++m_revision; }
+        void setHelpFooter(const std::string& footer) { m_footer = footer; ++m_revision; }
+        void setHelpDescription(const std::string& description) { m_description = description; ++m_revision; }
 
         /// @brief Parse the command-line arguments.
         /// @return A CliReader instance with parsed arguments.
-        /// @throws Arg::Exception subclasses on errors.
+        /// @throws Argy::Exception subclasses on errors.
         ParsedArgs parse() {
-            int argc = m_argc;
-            char** argv = m_argv;
+            return parse(argvTokens());
+        }
+
+        /// @brief Parse a tokenized command line held in caller-owned storage.
+        /// @param args Tokens laid out like argv: args[0] is the program name, options follow.
+        /// Tokens are only viewed, never copied, while lexing; they must stay valid until parse() returns.
+        /// Only values of string type are materialized into std::string during conversion.
+        /// The parser can be reused: every call starts from a clean slate and shares the same schema.
+        /// @return A CliReader instance with parsed arguments.
+        /// @throws Argy::Exception subclasses on errors.
+        ParsedArgs parse(const std::vector<std::string_view>& args) {
+            return parse(args, nullptr, nullptr);
+        }
+
+        /// @brief Parse the command-line arguments, writing bound members into a struct.
+        /// @param object Struct whose members were bound with add(names, help, &S::member).
+        /// @return A CliReader instance with every argument, bound ones included.
+        /// @throws Argy::Exception subclasses on errors; object is left unchanged in that case.
+        template<typename S>
+        ParsedArgs parseInto(S& object) {
+            return parse(argvTokens(), &object, &typeid(S));
+        }
+
+        /// @brief Parse a tokenized command line, writing bound members into a struct.
+        /// @param args Tokens laid out like argv, as for parse(args).
+        /// @param object Struct whose members were bound with add(names, help, &S::member).
+        /// @return A CliReader instance with every argument, bound ones included.
+        /// @throws Argy::Exception subclasses on errors; object is left unchanged in that case.
+        template<typename S>
+        ParsedArgs parseInto(const std::vector<std::string_view>& args, S& object) {
+            return parse(args, &object, &typeid(S));
+        }
+
+        /// @brief Parse a tokenized command line against a shared schema.
+        /// @param schema Argument definitions, usually obtained once from schema().
+        /// @param args Tokens laid out like argv: args[0] is the program name, options follow.
+        /// This touches no parser state and takes no locks, so any number of threads may call it
+        /// concurrently with the same schema. Validators must be safe to call concurrently too;
+        /// the built-in ones are. Help is not printed: check helpRequested() on the result instead.
+        /// @param resource Memory resource for the result's value slots and the parse's scratch space.
+        /// It must outlive the result. Moving the result keeps the resource; copying it does not.
+        /// String characters, list elements and lazy tokens still come from the global heap.
+        /// @return A CliReader instance with parsed arguments.
+        /// @throws Argy::Exception subclasses on errors.
+        static ParsedArgs parse(const std::shared_ptr<const Schema>& schema, const std::vector<std::string_view>& args,
+                                std::pmr::memory_resource* resource = std::pmr::get_default_resource()) {
+            std::pmr::vector<ArgValue> values(resource);
+            ParseError error;
+            std::shared_ptr<Deferred> deferred;
+            bool complete = parseTokens(*schema, args, values, error, deferred);
+            if (error) {
+                error.schema = schema;
+                error.raise();
+            }
+            if (!complete) return CliReader(schema, std::move(values), true);
+            runValidators(*schema, values, deferred.get());
+            return CliReader(schema, std::move(values), false, std::move(deferred));
+        }
+
+        /// @brief Parse a tokenized command line against a shared schema, reporting failure as a value.
+        /// @param schema Argument definitions, usually obtained once from schema().
+        /// @param args Tokens laid out like argv: args[0] is the program name, options follow.
+        /// Like the static parse(), this is safe to call concurrently. Lexing, conversion and missing
+        /// arguments never throw; the returned error carries a code, the argument id and the token
+        /// index, and only builds its message when asked. Validators report failure by throwing,
+        /// which is caught here (without exceptions, a failing validator aborts).
+        /// @param resource Memory resource for the result's value slots and the parse's scratch space,
+        /// as for the static parse().
+        /// @return The parsed arguments, or the first error found.
+        static ParseResult tryParse(const std::shared_ptr<const Schema>& schema, const std::vector<std::string_view>& args,
+                                    std::pmr::memory_resource* resource = std::pmr::get_default_resource()) {
+            ParseResult result;
+            std::pmr::vector<ArgValue> values(resource);
+            std::shared_ptr<Deferred> deferred;
+            bool complete = parseTokens(*schema, args, values, result.error, deferred);
+            if (result.error) {
+                result.error.schema = schema;
+                return result;
+            }
+            // Results are constructed in place: assigning one would copy its values out of the resource
+            if (!complete) return ParseResult{ CliReader(schema, std::move(values), true), {} };
+            for (size_t id = 0; id < schema->records.size(); ++id) {
+                // Lazy arguments are validated when first read
+                if (!schema->records[id].validated || (deferred && deferred->pending(id))) continue;
+                const ArgData& argument = schema->arguments[id];
+#ifndef ARGY_NO_EXCEPTIONS
+                try {
+                    argument.validator(values[argument.id]);
+                } catch (const std::exception& e) {
+                    result.error = validationError(schema, argument, e.what());
+                    return result;
+                } catch (...) {
+                    result.error = validationError(schema, argument, "Validation failed for argument '" + schema->keys[id] + "'");
+                    return result;
+                }
+#else
+                argument.validator(values[argument.id]);
+#endif
+            }
+            return ParseResult{ CliReader(schema, std::move(values), false, std::move(deferred)), {} };
+        }
+
+        /// @brief Parse many tokenized command lines in parallel against a shared schema.
+        /// @param schema Argument definitions, usually obtained once from schema().
+        /// @param commands Command lines laid out like argv (element 0 is the program name).
+        /// @param threadCount Worker threads to use; 0 means one per hardware thread.
+        /// Work is spread over a work-stealing pool; a failing line never affects the others.
+        /// @return One result per command line, in input order.
+        static std::vector<BatchResult> parseBatch(const std::shared_ptr<const Schema>& schema,
+                                                   const std::vector<std::vector<std::string_view>>& commands,
+                                                   unsigned threadCount = 0) {
+            std::vector<BatchResult> results(commands.size());
+            runParallel(commands.size(), threadCount, [&](size_t i) {
+                results[i] = tryParse(schema, commands[i]);
+            });
+            return results;
+        }
+
+        /// @brief Parse many raw command lines in parallel against a shared schema.
+        /// @param schema Argument definitions, usually obtained once from schema().
+        /// @param lines Whole command lines, such as the lines of a job-spec file; the first word
+        /// is the program name. Lines are split as by splitCommandLine().
+        /// @param threadCount Worker threads to use; 0 means one per hardware thread.
+        /// @return One result per line, in input order.
+        static std::vector<BatchResult> parseBatch(const std::shared_ptr<const Schema>& schema,
+                                                   const std::vector<std::string>& lines,
+                                                   unsigned threadCount = 0) {
+            std::vector<BatchResult> results(lines.size());
+            runParallel(lines.size(), threadCount, [&](size_t i) {
+                results[i] = tryParse(schema, splitCommandLine(lines[i]));
+            });
+            return results;
+        }
+
+        /// @brief Split a command line into whitespace-separated tokens without copying.
+        /// @param line The command line. A token starting with ' or " runs to the matching quote,
+        /// which is dropped; there are no escape sequences.
+        /// @return Views into line.
+        static std::vector<std::string_view> splitCommandLine(std::string_view line) {
+            std::vector<std::string_view> tokens;
+            size_t i = 0;
+            while (i < line.size()) {
+                while (i < line.size() && std::isspace(static_cast<unsigned char>(line[i]))) ++i;
+                if (i >= line.size()) break;
+                if (line[i] == '"' || line[i] == '\'') {
+                    size_t close = line.find(line[i], i + 1);
+                    if (close == std::string_view::npos) close = line.size();
+                    tokens.push_back(line.substr(i + 1, close - i - 1));
+                    i = close + 1;
+                    continue;
+                }
+                size_t start = i;
+                while (i < line.size() && !std::isspace(static_cast<unsigned char>(line[i]))) ++i;
+                tokens.push_back(line.substr(start, i - start));
+            }
+            return tokens;
+        }
 
-            std::string currentKey;
+    private:
+        /// @brief Run task(i) for every i in [0, count) on a small work-stealing thread pool.
+        /// Each worker owns a contiguous slice of the indices and claims them a few at a time;
+        /// once its slice is drained it steals claims from the other workers' slices.
+        template<typename Task>
+        static void runParallel(size_t count, unsigned threadCount, const Task& task) {
+            if (threadCount == 0) threadCount = std::max(1u, std::thread::hardware_concurrency());
+            size_t workerCount = std::min<size_t>(threadCount, count);
+            if (workerCount <= 1) {
+                for (size_t i = 0; i < count; ++i) task(i);
+                return;
+            }
+            struct Slice {
+                std::atomic<size_t> next{ 0 };
+                size_t end{ 0 };
+            };
+            std::vector<Slice> slices(workerCount);
+            for (size_t w = 0; w < workerCount; ++w) {
+                slices[w].next = count * w / workerCount;
+                slices[w].end = count * (w + 1) / workerCount;
+            }
+            const size_t grain = std::max<size_t>(1, count / (workerCount * 64));
+            auto work = [&](size_t self) {
+                for (size_t k = 0; k < workerCount; ++k) {
+                    Slice& slice = slices[(self + k) % workerCount];
+                    for (;;) {
+                        size_t begin = slice.next.fetch_add(grain);
+                        if (begin >= slice.end) break;
+                        size_t end = std::min(begin + grain, slice.end);
+                        for (size_t i = begin; i < end; ++i) task(i);
+                    }
+                }
+            };
+            std::vector<std::thread> workers;
+            workers.reserve(workerCount - 1);
+            for (size_t w = 1; w < workerCount; ++w) workers.emplace_back(work, w);
+            work(0);
+            for (auto& t : workers) t.join();
+        }
+
+        friend class ParseBuffer;
+
+        /// Tokens seen for one argument, as a [begin, end) range of indices into the parsed tokens
+        struct TokenRange {
+            bool provided{ false };
+            size_t begin{ 0 };
+            size_t end{ 0 };
+        };
+
+        /// @brief Assign tokens to arguments without converting them.
+        /// Allocates nothing: ranges is caller storage with one entry per argument, indexed by ArgData::id.
+        /// @param schema Argument definitions to parse against.
+        /// @param args Tokens laid out like argv: args[0] is the program name, options follow.
+        /// @param count Number of tokens.
+        /// @param ranges Receives the tokens of each argument; must start out value-initialized.
+        /// @param error Receives the first error found (its schema is left for the caller to set).
+        /// @return True if every token was assigned; false if help was requested or on error.
+        static bool lexTokens(const Schema& schema, const std::string_view* args, size_t count,
+                              TokenRange* ranges, ParseError& error) {
+            auto fail = [&](ParseErrorCode code, size_t tokenIndex) {
+                error.code = code;
+                error.argId = ParseError::npos;
+                error.tokenIndex = tokenIndex;
+                error.token = args[tokenIndex];
+                return false;
+            };
+
+            // Argument waiting for values; only the dense records are read while lexing
+            size_t current = Schema::npos;
             size_t positionalIndex = 0;
             bool positionalOnlyMode = false; // Flag: treat all subsequent args as positional after --
 
             // Parse loop
-            for (int i = 1; i < argc; ++i) {
-                std::string token = argv[i];
-                std::string key;
-                
-                // Check for help flags (only if not in positionalOnlyMode)
-                if (!positionalOnlyMode && (token == "--help" || token == "-h")) {
-                    m_helpHandler(argv[0]);
-                    // Return a copy of current state (even though no parsing was done)
-                    return CliReader(*this);
-                }
-                
-                // Check for POSIX -- delimiter for positional-only mode
-                if (token == "--" && !positionalOnlyMode) {
+            for (size_t i = 1; i < count; ++i) {
+                std::string_view token = args[i];
+                // After --, every token is a value
+                TokenKind kind = positionalOnlyMode ? TokenKind::Value : classifyToken(token);
+
+                switch (kind) {
+                case TokenKind::Separator:
+                    // POSIX -- delimiter: switch to positional-only mode and skip the token itself
                     positionalOnlyMode = true;
-                    continue; // Skip the -- token itself
-                }
-                
-                if (!positionalOnlyMode && startsWith(token, "--")) {
-                    std::string normKey = token.substr(2);
-                    // Find by any registered name (long forms are registered with and without dashes)
-                    auto it = std::find_if(m_arguments.begin(), m_arguments.end(), [&](const auto& pair) {
-                        const ArgData& a = pair.second;
-                        return std::find(a.names.begin(), a.names.end(), normKey) != a.names.end() ||
-                            std::find(a.names.begin(), a.names.end(), "--" + normKey) != a.names.end();
-                        });
-                    if (it == m_arguments.end()) throw UnknownArgumentException("Unknown argument: --" + normKey);
-                    currentKey = it->first;
-                    ArgData& arg = it->second;
-                    if (isListType(arg.type)) {
-                        arg.parsedValue = std::vector<std::string>{};
-                        continue;
-                    }
-                    if (arg.type == ArgType::Bool) {
-                        arg.parsedValue = true;
-                        currentKey.clear();
+                    break;
+
+                case TokenKind::LongFlag:
+                case TokenKind::ShortFlag: {
+                    // Check for help flags
+                    if (token == "--help" || token == "-h") {
+                        return false;
                     }
-                }
-                else if (!positionalOnlyMode && startsWith(token, "-") && token.size() > 1 && !isNegativeNumber(token)) {
-                    std::string normKey = token.substr(1);
-                    // Find by shortName (with or without dash)
-                    auto it = std::find_if(m_arguments.begin(), m_arguments.end(), [&](const auto& pair) {
-                        const ArgData& a = pair.second;
-                        return std::find(a.names.begin(), a.names.end(), normKey) != a.names.end() ||
-                            std::find(a.names.begin(), a.names.end(), "-" + normKey) != a.names.end();
-                    });
-                    if (it == m_arguments.end()) throw UnknownArgumentException("Unknown short argument: -" + normKey);
-                    currentKey = it->first;
-                    ArgData& arg = it->second;
-                    if (isListType(arg.type)) {
-                        arg.parsedValue = std::vector<std::string>{};
-                        continue;
+                    std::string_view normKey = token.substr(kind == TokenKind::LongFlag ? 2 : 1);
+                    // Find by any registered name through the name index
+                    current = schema.findId(normKey);
+                    if (current == Schema::npos) return fail(ParseErrorCode::UnknownArgument, i);
+                    ArgType type = schema.records[current].type;
+                    if (isListType(type)) {
+                        ranges[current] = { true, i + 1, i + 1 };
                     }
-                    if (arg.type == ArgType::Bool) {
-                        arg.parsedValue = true;
-                        currentKey.clear();
+                    else if (type == ArgType::Bool) {
+                        ranges[current] = { true, i, i };
+                        current = Schema::npos;
                     }
+                    break;
                 }
-                else {
+
+                case TokenKind::NegativeNumber:
+                case TokenKind::Value:
                     // Handle values for current flag or positional arguments
-                    if (!currentKey.empty() && !positionalOnlyMode) {
-                        ArgData& arg = m_arguments.at(currentKey);
-                        if (isListType(arg.type)) {
-                            if (std::holds_alternative<std::vector<std::string>>(arg.parsedValue)) {
-                                std::get<std::vector<std::string>>(arg.parsedValue).push_back(token);
-                            }
+                    if (current != Schema::npos && !positionalOnlyMode) {
+                        if (isListType(schema.records[current].type)) {
+                            // List values always directly follow their flag
+                            ranges[current].end = i + 1;
                         }
                         else {
-                            arg.parsedValue = token;
-                            currentKey.clear();
+                            ranges[current] = { true, i, i + 1 };
+                            current = Schema::npos;
                         }
                     }
                     else {
                         // Positional argument (either in normal mode or positionalOnlyMode after --)
-                        if (positionalOnlyMode || currentKey.empty()) {
-                            if (positionalIndex >= m_positionalOrder.size())
-                                throw UnexpectedPositionalArgumentException("Unexpected positional argument: " + token);
-                            std::string name = m_positionalOrder[positionalIndex++];
-                            ArgData& arg = m_arguments.at(name);
-                            arg.parsedValue = token;
-                        }
+                        if (positionalIndex >= schema.positionalOrder.size())
+                            return fail(ParseErrorCode::UnexpectedPositional, i);
+                        ranges[schema.positionalOrder[positionalIndex++]] = { true, i, i + 1 };
                     }
+                    break;
                 }
             }
+            return true;
+        }
 
-            // Validate required, set defaults, convert types, and run validator
-            for (auto& [key, argument] : m_arguments) {
-                if (!isListType(argument.type) && std::holds_alternative<std::monostate>(argument.parsedValue)) {
-                    if (argument.required)
-                        throw MissingArgumentException("Missing required argument: " + (argument.names.empty() ? key : argument.names[0]));
-                    argument.parsedValue = argument.defaultValue;
+        /// @brief Lex and convert tokens against a schema, filling in defaults.
+        /// Reads nothing but the schema and the tokens, writes nothing but values and error, and
+        /// never throws for bad input. Validators are not run; see runValidators().
+        /// @param schema Argument definitions to parse against.
+        /// @param args Tokens laid out like argv: args[0] is the program name, options follow.
+        /// @param values Receives one value per argument, indexed by ArgData::id.
+        /// @param error Receives the first error found (its schema is left for the caller to set).
+        /// @param deferred Receives the tokens of lazy arguments that were given and the ids of absent
+        /// arguments with computed defaults, whose slots in values stay empty; left null if there are none.
+        /// @return True if values was filled; false if help was requested or on error (values untouched).
+        /// Scratch space is allocated from the memory resource of values.
+        static bool parseTokens(const Schema& schema, const std::vector<std::string_view>& args,
+                                std::pmr::vector<ArgValue>& values, ParseError& error,
+                                std::shared_ptr<Deferred>& deferred) {
+            auto fail = [&](ParseErrorCode code, size_t argId, size_t tokenIndex) {
+                error.code = code;
+                error.argId = argId;
+                error.tokenIndex = tokenIndex;
+                error.token = tokenIndex < args.size() ? args[tokenIndex] : std::string_view();
+                return false;
+            };
+            // Scratch space comes from the same memory resource as the values
+            std::pmr::vector<TokenRange> ranges(schema.records.size(), values.get_allocator());
+            if (!lexTokens(schema, args.data(), args.size(), ranges.data(), error)) return false;
+
+            // Validate required, set defaults and convert types
+            std::pmr::vector<ArgValue> out(schema.records.size(), values.get_allocator());
+            size_t deferredArgs = 0, deferredTokens = 0, deferredBytes = 0;
+            for (size_t id = 0; id < schema.records.size(); ++id) {
+                const ArgRecord& record = schema.records[id];
+                const TokenRange& range = ranges[id];
+                ArgValue& value = out[id];
+                if (!range.provided) {
+                    if (record.required)
+                        return fail(ParseErrorCode::MissingArgument, id, ParseError::npos);
+                    value = schema.defaults[id];
+                    if (record.computedDefault) ++deferredArgs; // computed on first read
                 }
-                else if (isListType(argument.type) && std::holds_alternative<std::monostate>(argument.parsedValue)) {
-                    if (argument.required)
-                        throw MissingArgumentException("Missing required list argument: " + (argument.names.empty() ? key : argument.names[0]));
-                    argument.parsedValue = argument.defaultValue;
+                else if (record.deferred()) {
+                    // Only measured here; copied below once nothing else can fail
+                    ++deferredArgs;
+                    deferredTokens += range.end - range.begin;
+                    for (size_t t = range.begin; t < range.end; ++t) deferredBytes += args[t].size();
                 }
                 else {
-                    // Convert single value types
-                    if (!isListType(argument.type) && std::holds_alternative<std::string>(argument.parsedValue)) {
-                        const std::string& val = std::get<std::string>(argument.parsedValue);
-                        try {
-                            switch (argument.type) {
-                            case ArgType::Int:
-                                argument.parsedValue = std::stoi(val);
-                                break;
-                            case ArgType::Float:
-                                argument.parsedValue = std::stof(val);
-                                break;
-                            case ArgType::Bool:
-                                argument.parsedValue = (val == "true" || val == "1");
-                                break;
-                            case ArgType::String:
-                                // already string
-                                break;
-                            default:
-                                break;
-                            }
-                        }
-                        catch (const std::invalid_argument& e) {
-                            throw InvalidValueException(std::string("Invalid value for argument '") + (argument.names.empty() ? key : argument.names[0]) + "': " + val + " (" + e.what() + ")");
-                        }
-                        catch (const std::out_of_range& e) {
-                            throw OutOfRangeException(std::string("Value out of range for argument '") + (argument.names.empty() ? key : argument.names[0]) + "': " + val + " (" + e.what() + ")");
-                        }
-                    }
-                    // Convert list types
-                    else if (isListType(argument.type) && std::holds_alternative<std::vector<std::string>>(argument.parsedValue)) {
-                        const auto& vec = std::get<std::vector<std::string>>(argument.parsedValue);
-                        try {
-                            switch (argument.type) {
-                            case ArgType::IntList: {
-                                std::vector<int> out;
-                                for (const auto& v : vec) out.push_back(std::stoi(v));
-                                argument.parsedValue = out;
-                                break;
-                            }
-                            case ArgType::FloatList: {
-                                std::vector<float> out;
-                                for (const auto& v : vec) out.push_back(std::stof(v));
-                                argument.parsedValue = out;
-                                break;
-                            }
-                            case ArgType::BoolList: {
-                                std::vector<bool> out;
-                                for (const auto& v : vec) out.push_back(v == "true" || v == "1");
-                                argument.parsedValue = out;
-                                break;
-                            }
-                            case ArgType::StringList:
-                                // already string vector
-                                break;
-                            default:
-                                break;
-                            }
-                        }
-                        catch (const std::invalid_argument& e) {
-                            throw InvalidValueException("Invalid value in list for argument '" + (argument.names.empty() ? key : argument.names[0]) + "'" + std::string(" (") + e.what() + ")");
-                        }
-                        catch (const std::out_of_range& e) {
-                            throw InvalidValueException("Value out of range in list for argument '" + (argument.names.empty() ? key : argument.names[0]) + "'" + std::string(" (") + e.what() + ")");
-                        }
-                    }
+                    size_t bad = range.begin;
+                    ParseErrorCode code = convertTokens(record.type, args.data() + range.begin, args.data() + range.end, value, bad);
+                    if (code != ParseErrorCode::None) return fail(code, id, range.begin + bad);
                 }
-                // Run validator if present
-                if (argument.validator) {
-                    argument.validator(argument.parsedValue);
+            }
+            if (deferredArgs > 0) deferred = makeDeferred(schema, args, ranges.data(), deferredTokens, deferredBytes);
+            values = std::move(out);
+            return true;
+        }
+
+        /// @brief Copy the tokens of the lazy arguments that were given, and note absent computed defaults.
+        static std::shared_ptr<Deferred> makeDeferred(const Schema& schema, const std::vector<std::string_view>& args,
+                                                      const TokenRange* ranges, size_t tokenCount, size_t byteCount) {
+            auto deferred = std::make_shared<Deferred>();
+            size_t count = schema.records.size();
+            deferred->text.reserve(byteCount);
+            deferred->tokens.reserve(tokenCount);
+            deferred->spans.resize(count);
+            deferred->values.resize(count);
+            deferred->ready = std::make_unique<std::atomic<bool>[]>(count);
+            deferred->convert = &convertTokens;
+            for (size_t id = 0; id < count; ++id) {
+                const TokenRange& range = ranges[id];
+                if (!range.provided && schema.records[id].computedDefault) deferred->spans[id].computed = true;
+                if (!range.provided || !schema.records[id].deferred()) continue;
+                deferred->spans[id] = { true, false, deferred->tokens.size(), deferred->tokens.size() + (range.end - range.begin), range.begin };
+                for (size_t t = range.begin; t < range.end; ++t) {
+                    // text was reserved up front, so earlier views stay valid
+                    size_t offset = deferred->text.size();
+                    deferred->text.append(args[t]);
+                    deferred->tokens.emplace_back(deferred->text.data() + offset, args[t].size());
                 }
             }
+            return deferred;
+        }
 
-            // Create a copy of the CliReader part and return it
+        /// @brief Parse, validate, then copy bound values into their targets.
+        /// @param object Struct for member bindings of type objectType, or nullptr for none.
+        ParsedArgs parse(const std::vector<std::string_view>& args, void* object, const std::type_info* objectType) {
+            std::pmr::vector<ArgValue> values;
+            ParseError error;
+            std::shared_ptr<Deferred> deferred;
+            bool complete = parseTokens(*m_schema, args, values, error, deferred);
+            if (error) {
+                error.schema = m_schema;
+                error.raise();
+            }
+            if (!complete) {
+                std::string programName = args.empty() ? std::string() : std::string(args[0]);
+                if (m_helpHandler) {
+                    m_helpHandler(programName);
+                }
+                else {
+                    // "--help <term>" lists only the matching arguments
+                    std::string_view query = helpQuery(args);
+                    if (query.empty()) printHelp(programName);
+                    else printHelp(std::cout, programName, query);
+                    std::exit(0);
+                }
+                // Nothing was parsed, so the result holds no values, not those of an earlier parse
+                return CliReader(m_schema, std::move(values), true);
+            }
+            runValidators(*m_schema, values, deferred.get());
+            deliverTargets(*m_schema, values, object, objectType);
+            m_values = std::move(values);
+            m_deferred = std::move(deferred);
+            // The result shares the schema with this parser and owns only its values
             return ParsedArgs(*this);
         }
 
+        /// @brief Tokens of the argv given to the constructor.
+        std::vector<std::string_view> argvTokens() const {
+            std::vector<std::string_view> args;
+            args.reserve(m_argc > 0 ? static_cast<size_t>(m_argc) : 0);
+            for (int i = 0; i < m_argc; ++i) args.emplace_back(m_argv[i]);
+            return args;
+        }
+
+        /// @brief Copy the values of bound arguments into their variables or into object's members.
+        /// The values stay in the result, so get() and has() report bound arguments like any other.
+        static void deliverTargets(const Schema& schema, const std::pmr::vector<ArgValue>& values, void* object,
+                                   const std::type_info* objectType) {
+            for (size_t id = 0; id < schema.records.size(); ++id) {
+                if (!schema.records[id].bound) continue;
+                const ArgData& argument = schema.arguments[id];
+                if (argument.targetOwner && (!objectType || *argument.targetOwner != *objectType)) continue;
+                const ArgValue& value = values[argument.id];
+                if (std::holds_alternative<std::monostate>(value)) continue;
+                argument.target(object, value);
+            }
+        }
+
+        /// @brief Run every argument's validator over freshly parsed values.
+        /// @param deferred Lazy arguments to skip; they are validated when first read.
+        /// @throws Whatever a validator throws.
+        static void runValidators(const Schema& schema, const std::pmr::vector<ArgValue>& values, const Deferred* deferred) {
+            for (size_t id = 0; id < schema.records.size(); ++id) {
+                if (schema.records[id].validated && !(deferred && deferred->pending(id))) {
+                    schema.arguments[id].validator(values[id]);
+                }
+            }
+        }
+
+        /// @brief Describe a validator failure as a ParseError.
+        static ParseError validationError(const std::shared_ptr<const Schema>& schema, const ArgData& argument, std::string detail) {
+            ParseError error;
+            error.code = ParseErrorCode::ValidationFailed;
+            error.argId = argument.id;
+            error.schema = schema;
+            error.detail = std::move(detail);
+#ifndef ARGY_NO_EXCEPTIONS
+            error.exception = std::current_exception();
+#endif
+            return error;
+        }
+
+        /// @brief Convert the raw tokens captured for an argument to its declared type.
+        /// @param type Declared type of the argument whose tokens to convert.
+        /// @param first Pointer to the first token.
+        /// @param last Pointer one past the last token.
+        /// @param out Receives the converted value.
+        /// @param bad Receives the offset from first of the token that failed, on error.
+        /// @return ParseErrorCode::None, InvalidValue or OutOfRange.
+        static ParseErrorCode convertTokens(ArgType type, const std::string_view* first, const std::string_view* last,
+                                            ArgValue& out, size_t& bad) {
+            size_t count = static_cast<size_t>(last - first);
+            bad = 0;
+            // Convert list types
+            if (isListType(type)) {
+                switch (type) {
+                case ArgType::IntList:
+                    return convertList(first, last, out.emplace<std::vector<int>>(), bad);
+                case ArgType::FloatList:
+                    return convertList(first, last, out.emplace<std::vector<float>>(), bad);
+                case ArgType::BoolList: {
+                    auto& vec = out.emplace<std::vector<bool>>();
+                    vec.reserve(count);
+                    for (auto v = first; v != last; ++v) vec.push_back(*v == "true" || *v == "1");
+                    return ParseErrorCode::None;
+                }
+                default:
+                    out.emplace<std::vector<std::string>>(first, last);
+                    return ParseErrorCode::None;
+                }
+            }
+            // A bool flag carries no token; its presence means true
+            if (count == 0) {
+                out = type == ArgType::Bool ? ArgValue(true) : ArgValue{};
+                return ParseErrorCode::None;
+            }
+            // Convert single value types
+            std::string_view val = *first;
+            switch (type) {
+            case ArgType::Int:
+                return toErrorCode(toNumber(val, out.emplace<int>()));
+            case ArgType::Float:
+                return toErrorCode(toNumber(val, out.emplace<float>()));
+            case ArgType::Bool:
+                out = (val == "true" || val == "1");
+                return ParseErrorCode::None;
+            default:
+                out.emplace<std::string>(val);
+                return ParseErrorCode::None;
+            }
+        }
+
+        /// @brief Convert a run of tokens to a vector of numbers.
+        /// @tparam T int or float.
+        /// @param bad Receives the offset from first of the token that failed, on error.
+        /// @return ParseErrorCode::None, InvalidValue or OutOfRange.
+        template<typename T>
+        static ParseErrorCode convertList(const std::string_view* first, const std::string_view* last, std::vector<T>& out, size_t& bad) {
+            out.resize(static_cast<size_t>(last - first));
+            T* dest = out.data();
+            for (auto v = first; v != last; ++v, ++dest) {
+                ParseErrorCode code = toErrorCode(toNumber(*v, *dest));
+                if (code != ParseErrorCode::None) {
+                    bad = static_cast<size_t>(v - first);
+                    return code;
+                }
+            }
+            return ParseErrorCode::None;
+        }
+
+        /// @brief Map a numeric conversion result to a parse error code.
+        static ParseErrorCode toErrorCode(std::errc ec) {
+            if (ec == std::errc{}) return ParseErrorCode::None;
+            return ec == std::errc::result_out_of_range ? ParseErrorCode::OutOfRange : ParseErrorCode::InvalidValue;
+        }
+
+    public:
         /// @brief Print help message to stdout.
         /// @param programName The program's executable name (usually argv[0]).
         /// This prints a usage summary and all registered arguments, including their help text and default values.
         void printHelp(const std::string& programName) const {
-            // ANSI color codes
-            const char* bold = m_useColors ? "\033[1m" : "";
-            const char* cyan = m_useColors ? "\033[36m" : "";
-            const char* yellow = m_useColors ? "\033[33m" : "";
-            const char* reset = m_useColors ? "\033[0m" : "";
-            const char* gray = m_useColors ? "\033[90m" : "";
-            const char* green = m_useColors ? "\033[32m" : "";
+            printHelp(std::cout, programName);
+        }
+
+        /// @brief Write the help message to a stream in a single write.
+        /// @param os Stream to write to.
+        /// @param programName The program's executable name (usually argv[0]).
+        void printHelp(std::ostream& os, const std::string& programName) const {
+            std::shared_ptr<const std::string> text = cachedHelp(programName);
+            os.write(text->data(), static_cast<std::streamsize>(text->size()));
+            os.flush();
+        }
+
+        /// @brief Write the help message to a file descriptor, bypassing iostreams.
+        /// @param fd Open file descriptor, e.g. 1 for stdout.
+        /// @param programName The program's executable name (usually argv[0]).
+        /// @return True if the whole message was written.
+        bool printHelp(int fd, const std::string& programName) const {
+            std::shared_ptr<const std::string> text = cachedHelp(programName);
+            const char* data = text->data();
+            size_t left = text->size();
+            while (left > 0) {
+#ifdef _WIN32
+                int written = ::_write(fd, data, static_cast<unsigned>(std::min<size_t>(left, 1u << 30)));
+#else
+                ssize_t written = ::write(fd, data, left);
+#endif
+                if (written < 0 && errno == EINTR) continue;
+                if (written <= 0) return false;
+                data += written;
+                left -= static_cast<size_t>(written);
+            }
+            return true;
+        }
+
+        /// @brief Get the rendered help message.
+        /// Rendering happens once; the text is cached until an argument, validator, binding or help
+        /// header, footer or description changes, or a different program name is given.
+        /// Safe to call from several threads, as are printHelp() and searchHelp(), while the parser is not changed.
+        /// @param programName The program's executable name (usually argv[0]).
+        /// @return The full help message, valid until the parser changes or help is rendered for another program name.
+        const std::string& helpText(const std::string& programName) const {
+            return *cachedHelp(programName);
+        }
+
+        /// @brief Write only the help entries that match a search term.
+        /// @param os Stream to write to.
+        /// @param programName The program's executable name (usually argv[0]).
+        /// @param term Words to look for, as for searchHelp().
+        void printHelp(std::ostream& os, const std::string& programName, std::string_view term) const {
+            std::string out;
+            renderMatches(out, programName, term, searchHelp(term));
+            os.write(out.data(), static_cast<std::streamsize>(out.size()));
+            os.flush();
+        }
+
+        /// @brief Write the help message as it is rendered, for schemas too large to render up front.
+        /// Unlike printHelp(), nothing is measured or cached: names are padded to nameWidth (longer
+        /// ones push their line out), types to the widest type label, and lines go out in small chunks
+        /// and at the end of every section. Output starts at once and memory use does not grow with the
+        /// schema, so this suits piping a generated schema's help into a pager.
+        /// @param os Stream to write to.
+        /// @param programName The program's executable name (usually argv[0]).
+        /// @param nameWidth Column width for argument names.
+        void streamHelp(std::ostream& os, const std::string& programName, size_t nameWidth = 24) const {
+            const HelpStyle style = helpStyle();
+            const Schema& schema = *m_schema;
+            const size_t typeWidth = std::strlen("<string[]>");
+            std::string chunk;
+            chunk.reserve(streamChunkSize);
+            auto flush = [&]() {
+                os.write(chunk.data(), static_cast<std::streamsize>(chunk.size()));
+                os.flush();
+                chunk.clear();
+            };
+
+            // Header, usage and description go out before any argument is visited
+            if (!m_header.empty())
+                chunk.append(m_header).append("\n\n");
+            chunk.append(style.bold).append("Usage: ").append(style.reset).append(programName);
+            for (size_t positional : schema.positionalOrder)
+                chunk.append(" ").append(style.cyan).append("<").append(schema.keys[positional]).append(">").append(style.reset);
+            chunk.append(" ").append(style.green).append("[options]").append(style.reset).append("\n\n");
+            if (!m_description.empty())
+                chunk.append(m_description).append("\n\n");
+            flush();
+
+            if (!schema.positionalOrder.empty()) {
+                chunk.append(style.bold).append("Positional:").append(style.reset).append("\n");
+                for (size_t id : schema.positionalOrder) {
+                    appendPositionalRow(chunk, style, id, nameWidth);
+                    if (chunk.size() >= streamChunkSize) flush();
+                }
+                chunk.append("\n");
+                flush();
+            }
+
+            chunk.append(style.bold).append("Options:").append(style.reset).append("\n");
+            for (const auto& argument : schema.arguments) {
+                if (argument.positional) continue;
+                appendOptionRow(chunk, style, argument, nameWidth, typeWidth);
+                if (chunk.size() >= streamChunkSize) flush();
+            }
+            chunk.append("  ").append(style.green).append(helpFlag).append(style.reset);
+            chunk.append(nameWidth > helpFlag.size() ? nameWidth - helpFlag.size() : 0, ' ');
+            chunk.append(typeWidth + 1, ' ').append("  Show this help message\n");
+            if (!m_footer.empty())
+                chunk.append("\n").append(m_footer).append("\n");
+            flush();
+        }
+
+        /// @brief Find the arguments whose names, aliases or help text match a search term.
+        /// Each word of term must prefix a word of the argument's names or help text, ignoring case.
+        /// The index behind this is built on first use and rebuilt only after the schema changes.
+        /// @param term One or more words separated by spaces or punctuation.
+        /// @return Ids of the matching arguments in declaration order; empty if term has no words.
+        std::vector<size_t> searchHelp(std::string_view term) const {
+            std::shared_ptr<const HelpIndex> held = helpIndex();
+            const HelpIndex& index = *held;
+            // Every indexed word starting with a query word sits in one sorted run
+            struct Run { size_t begin, end, ids; };
+            std::vector<Run> runs;
+            forEachHelpWord(term, [&](std::string_view word) {
+                auto lo = std::lower_bound(index.words.begin(), index.words.end(), word);
+                auto hi = lo;
+                size_t ids = 0;
+                for (; hi != index.words.end() && startsWith(*hi, word); ++hi)
+                    ids += index.postings[static_cast<size_t>(hi - index.words.begin())].size();
+                runs.push_back({ static_cast<size_t>(lo - index.words.begin()), static_cast<size_t>(hi - index.words.begin()), ids });
+            });
+            std::vector<size_t> result;
+            if (runs.empty()) return result;
+            // Start from the rarest word, then keep only the ids every other word also has
+            std::sort(runs.begin(), runs.end(), [](const Run& a, const Run& b) { return a.ids < b.ids; });
+            for (size_t w = runs[0].begin; w < runs[0].end; ++w)
+                result.insert(result.end(), index.postings[w].begin(), index.postings[w].end());
+            std::sort(result.begin(), result.end());
+            result.erase(std::unique(result.begin(), result.end()), result.end());
+            for (size_t r = 1; r < runs.size() && !result.empty(); ++r) {
+                auto missing = [&](size_t id) {
+                    for (size_t w = runs[r].begin; w < runs[r].end; ++w)
+                        if (std::binary_search(index.postings[w].begin(), index.postings[w].end(), id)) return false;
+                    return true;
+                };
+                result.erase(std::remove_if(result.begin(), result.end(), missing), result.end());
+            }
+            return result;
+        }
+
+        /// @brief Get the search term given after -h or --help, as in "prog --help color".
+        /// @param args Tokens laid out like argv: args[0] is the program name, options follow.
+        /// @return The token after the first help flag if it is a value, else an empty view.
+        static std::string_view helpQuery(const std::vector<std::string_view>& args) {
+            for (size_t i = 1; i < args.size(); ++i) {
+                // Same rule as the lexer: help flags after -- are values
+                if (args[i] == "--") break;
+                if (args[i] != "--help" && args[i] != "-h") continue;
+                if (i + 1 < args.size() && classifyToken(args[i + 1]) == TokenKind::Value) return args[i + 1];
+                break;
+            }
+            return {};
+        }
+
+    private:
+        /// @struct HelpStyle
+        /// @brief ANSI codes used by help output; all empty when colors are off.
+        struct HelpStyle {
+            const char* bold;
+            const char* cyan;
+            const char* yellow;
+            const char* reset;
+            const char* gray;
+            const char* green;
+        };
+
+        /// @brief Mutex that a copied parser does not share: the copy gets its own.
+        struct HelpMutex {
+            std::mutex mutex;
+            HelpMutex() = default;
+            HelpMutex(const HelpMutex&) {}
+            HelpMutex& operator=(const HelpMutex&) { return *this; }
+        };
+
+        /// @struct HelpIndex
+        /// @brief Inverted index from lowercase words of names and help text to argument ids.
+        struct HelpIndex {
+            std::vector<std::string> words;            ///< Distinct indexed words, sorted.
+            std::vector<std::vector<size_t>> postings; ///< Ids containing each word, ascending; parallel to words.
+        };
+
+        HelpStyle helpStyle() const {
+            if (!m_useColors) return HelpStyle{ "", "", "", "", "", "" };
+            return HelpStyle{ "\033[1m", "\033[36m", "\033[33m", "\033[0m", "\033[90m", "\033[32m" };
+        }
+
+        /// @brief Call fn with each lowercase run of letters and digits in text.
+        template<typename F>
+        static void forEachHelpWord(std::string_view text, F&& fn) {
+            std::string word;
+            for (size_t i = 0; i <= text.size(); ++i) {
+                unsigned char c = i < text.size() ? static_cast<unsigned char>(text[i]) : ' ';
+                if (std::isalnum(c)) {
+                    word += static_cast<char>(std::tolower(c));
+                }
+                else if (!word.empty()) {
+                    fn(std::string_view(word));
+                    word.clear();
+                }
+            }
+        }
+
+        /// @brief Get the rendered help, rendering it if the parser or the program name changed since.
+        /// The text is shared so a caller still writing it is not affected by another thread replacing it.
+        std::shared_ptr<const std::string> cachedHelp(const std::string& programName) const {
+            std::lock_guard<std::mutex> lock(m_helpMutex.mutex);
+            if (!m_helpCache || m_helpRevision != m_revision || m_helpProgram != programName) {
+                auto text = std::make_shared<std::string>();
+                renderHelp(*text, programName);
+                m_helpCache = std::move(text);
+                m_helpProgram = programName;
+                m_helpRevision = m_revision;
+            }
+            return m_helpCache;
+        }
+
+        /// @brief Get the search index, building it if the schema changed since it was built.
+        std::shared_ptr<const HelpIndex> helpIndex() const {
+            std::lock_guard<std::mutex> lock(m_helpMutex.mutex);
+            if (m_helpIndex && m_helpIndexRevision == m_revision) return m_helpIndex;
+            // Group ids by word; arguments are visited in id order, so every list stays ascending
+            std::unordered_map<std::string, std::vector<size_t>> postings;
+            postings.reserve(m_schema->arguments.size() * 2);
+            for (const auto& argument : m_schema->arguments) {
+                auto add = [&](std::string_view word) {
+                    auto& ids = postings[std::string(word)];
+                    if (ids.empty() || ids.back() != argument.id) ids.push_back(argument.id);
+                };
+                // Names are split like queries, so "--cache-dir" is found by "cache" and by "cache-dir"
+                for (const auto& name : argument.names) forEachHelpWord(name, add);
+                forEachHelpWord(argument.help, add);
+            }
+            // Sort pointers to the entries rather than moving the entries around
+            std::vector<std::pair<const std::string, std::vector<size_t>>*> sorted;
+            sorted.reserve(postings.size());
+            for (auto& entry : postings) sorted.push_back(&entry);
+            std::sort(sorted.begin(), sorted.end(), [](const auto* a, const auto* b) { return a->first < b->first; });
+            auto index = std::make_shared<HelpIndex>();
+            index->words.reserve(sorted.size());
+            index->postings.reserve(sorted.size());
+            for (auto* entry : sorted) {
+                index->words.push_back(entry->first);
+                index->postings.push_back(std::move(entry->second));
+            }
+            m_helpIndex = std::move(index);
+            m_helpIndexRevision = m_revision;
+            return m_helpIndex;
+        }
+
+        /// @brief Append the help message to out.
+        void renderHelp(std::string& out, const std::string& programName) const {
+            const HelpStyle style = helpStyle();
+            const Schema& schema = *m_schema;
 
             // Header
             if (!m_header.empty())
-                std::cout << m_header << "\n\n";
-            
+                out.append(m_header).append("\n\n");
+
             // Usage brief
-            std::cout << bold << "Usage: " << reset << programName;
-            for (const auto& positional : m_positionalOrder)
-                std::cout << " " << cyan << "<" << positional << ">" << reset;
-            std::cout << " " << green << "[options]" << reset << "\n\n";
+            out.append(style.bold).append("Usage: ").append(style.reset).append(programName);
+            for (size_t positional : schema.positionalOrder)
+                out.append(" ").append(style.cyan).append("<").append(schema.keys[positional]).append(">").append(style.reset);
+            out.append(" ").append(style.green).append("[options]").append(style.reset).append("\n\n");
 
             // Usage details
             if (!m_description.empty())
-                std::cout << m_description << "\n\n";
+                out.append(m_description).append("\n\n");
 
             // Section: Positional arguments
-            if (!m_positionalOrder.empty()) {
-                std::cout << bold << "Positional:" << reset << "\n";
+            if (!schema.positionalOrder.empty()) {
+                out.append(style.bold).append("Positional:").append(style.reset).append("\n");
                 // Find max width for alignment (name only, no type)
                 size_t maxPosLen = 0;
-                std::vector<std::string> posNames;
-                for (const auto& key : m_positionalOrder) {
-                    const auto& argument = m_arguments.at(key);
-                    std::string pos = !argument.longForms.empty() ? argument.longForms[0] : (argument.names.empty() ? key : argument.names[0]);
-                    if (pos.size() > maxPosLen) maxPosLen = pos.size();
-                    posNames.push_back(pos);
-                }
-                size_t posIdx = 0;
-                for (const auto& key : m_positionalOrder) {
-                    const auto& argument = m_arguments.at(key);
-                    std::string pos = posNames[posIdx++];
-                    std::cout << "  " << cyan << pos << reset;
-                    size_t pad = maxPosLen > pos.size() ? maxPosLen - pos.size() : 0;
-                    std::cout << std::string(pad, ' ');
-                    // Help message starts here
-                    if (!argument.help.empty())
-                        std::cout << "  " << argument.help;
-                    if (!std::holds_alternative<std::monostate>(argument.defaultValue))
-                        std::cout << gray << " (default: " << toString(argument.defaultValue) << ")" << reset;
-                    std::cout << "\n";
-                }
-                std::cout << "\n";
+                for (size_t id : schema.positionalOrder)
+                    maxPosLen = std::max(maxPosLen, positionalName(id).size());
+                for (size_t id : schema.positionalOrder)
+                    appendPositionalRow(out, style, id, maxPosLen);
+                out.append("\n");
             }
 
             // Section: Options
-            std::cout << bold << "Options:" << reset << "\n";
-            // Find max width for alignment (name only, no type)
-            size_t maxOptNameLen = 0;
-            std::vector<std::string> optNames;
-            std::vector<std::string> valueTypes;
-            std::vector<bool> isBoolFlag;
-            for (const auto& [key, argument] : m_arguments) {
-                if (!argument.positional) {
-                    std::string opt;
-                    // Prefer showing short and long forms if available
-                    if (!argument.shortForms.empty() && !argument.longForms.empty()) {
-                        opt = "-" + argument.shortForms[0] + ", --" + argument.longForms[0];
+            out.append(style.bold).append("Options:").append(style.reset).append("\n");
+            // Find max widths for alignment; the help flag counts too
+            size_t maxOptNameLen = helpFlag.size();
+            size_t maxTypeLen = 0;
+            for (const auto& argument : schema.arguments) {
+                if (argument.positional) continue;
+                maxOptNameLen = std::max(maxOptNameLen, optionLabelSize(argument));
+                maxTypeLen = std::max(maxTypeLen, std::strlen(valueLabel(argument.type)));
+            }
+            // Print options with aligned <value> and help text
+            for (const auto& argument : schema.arguments) {
+                if (!argument.positional) appendOptionRow(out, style, argument, maxOptNameLen, maxTypeLen);
+            }
+            // Help flag, aligned
+            out.append("  ").append(style.green).append(helpFlag).append(style.reset);
+            out.append(maxOptNameLen - helpFlag.size() + maxTypeLen + 1, ' ').append("  Show this help message\n");
+
+            // Footer
+            if (!m_footer.empty())
+                out.append("\n").append(m_footer).append("\n");
+        }
+
+        /// @brief Append the entries of the given arguments, aligned among themselves, under a search banner.
+        void renderMatches(std::string& out, const std::string& programName, std::string_view term,
+                           const std::vector<size_t>& ids) const {
+            const HelpStyle style = helpStyle();
+            const Schema& schema = *m_schema;
+            if (ids.empty()) {
+                out.append("No arguments match \"").append(term).append("\". Run '").append(programName)
+                   .append(" --help' to list all arguments.\n");
+                return;
+            }
+            size_t maxPosLen = 0, maxOptNameLen = 0, maxTypeLen = 0;
+            bool anyPositional = false, anyOption = false;
+            for (size_t id : ids) {
+                const ArgData& argument = schema.arguments[id];
+                if (argument.positional) {
+                    anyPositional = true;
+                    maxPosLen = std::max(maxPosLen, positionalName(id).size());
+                }
+                else {
+                    anyOption = true;
+                    maxOptNameLen = std::max(maxOptNameLen, optionLabelSize(argument));
+                    maxTypeLen = std::max(maxTypeLen, std::strlen(valueLabel(argument.type)));
+                }
+            }
+            out.append(style.bold).append("Arguments matching \"").append(term).append("\":").append(style.reset).append("\n\n");
+            if (anyPositional) {
+                out.append(style.bold).append("Positional:").append(style.reset).append("\n");
+                for (size_t id : ids)
+                    if (schema.arguments[id].positional) appendPositionalRow(out, style, id, maxPosLen);
+                if (anyOption) out.append("\n");
+            }
+            if (anyOption) {
+                out.append(style.bold).append("Options:").append(style.reset).append("\n");
+                for (size_t id : ids) {
+                    const ArgData& argument = schema.arguments[id];
+                    if (!argument.positional) appendOptionRow(out, style, argument, maxOptNameLen, maxTypeLen);
+                }
+            }
+        }
+
+        /// @brief Append one positional argument's help line.
+        void appendPositionalRow(std::string& out, const HelpStyle& style, size_t id, size_t nameWidth) const {
+            const ArgData& argument = m_schema->arguments[id];
+            const std::string& pos = positionalName(id);
+            out.append("  ").append(style.cyan).append(pos).append(style.reset);
+            out.append(nameWidth > pos.size() ? nameWidth - pos.size() : 0, ' ');
+            // Help message starts here
+            if (!argument.help.empty())
+                out.append("  ").append(argument.help);
+            appendDefault(out, style, argument);
+            out.append("\n");
+        }
+
+        /// @brief Append one option's help line and, if it has more names, its alias line.
+        static void appendOptionRow(std::string& out, const HelpStyle& style, const ArgData& argument,
+                                    size_t nameWidth, size_t typeWidth) {
+            size_t labelStart = out.size() + 2 + std::strlen(style.green);
+            out.append("  ").append(style.green);
+            appendOptionLabel(out, argument);
+            size_t labelSize = out.size() - labelStart;
+            out.append(style.reset);
+            out.append(nameWidth > labelSize ? nameWidth - labelSize : 0, ' ');
+            std::string_view valueType = valueLabel(argument.type);
+            if (!valueType.empty()) {
+                out.append(" ").append(style.gray).append(valueType).append(style.reset);
+                out.append(typeWidth > valueType.size() ? typeWidth - valueType.size() : 0, ' ');
+            }
+            else {
+                out.append(typeWidth + 1, ' '); // +1 for space before type
+            }
+            // Help message starts here
+            if (!argument.help.empty())
+                out.append("  ").append(argument.help);
+            appendDefault(out, style, argument);
+            if (argument.required)
+                out.append(" ").append(style.yellow).append("(required)").append(style.reset);
+            out.append("\n");
+            // Print aliases (remaining registered names) beneath the main option line.
+            // add() files every name under shortForms or longForms, so those two cover all aliases.
+            if (argument.shortForms.size() > 1 || argument.longForms.size() > 1) {
+                out.append(style.gray).append("  alias: [").append(style.green);
+                bool first = true;
+                for (size_t i = 1; i < argument.shortForms.size(); ++i) {
+                    out.append(first ? "-" : ", -").append(argument.shortForms[i]);
+                    first = false;
+                }
+                for (size_t i = 1; i < argument.longForms.size(); ++i) {
+                    out.append(first ? "--" : ", --").append(argument.longForms[i]);
+                    first = false;
+                }
+                out.append(style.reset).append("] \n");
+            }
+        }
+
+        /// @brief Append " (default: ...)"; a computed default shows its description and is not evaluated.
+        static void appendDefault(std::string& out, const HelpStyle& style, const ArgData& argument) {
+            if (argument.defaultFn)
+                out.append(style.gray).append(" (default: ").append(argument.defaultText).append(")").append(style.reset);
+            else if (!std::holds_alternative<std::monostate>(argument.defaultValue))
+                out.append(style.gray).append(" (default: ").append(toString(argument.defaultValue)).append(")").append(style.reset);
+        }
+
+        static constexpr std::string_view helpFlag = "-h, --help"; ///< Label of the built-in help option.
+        static constexpr size_t streamChunkSize = 4096; ///< Bytes streamHelp() gathers before writing.
+
+        /// @brief Name a positional argument is listed under in help.
+        const std::string& positionalName(size_t id) const {
+            const ArgData& argument = m_schema->arguments[id];
+            if (!argument.longForms.empty()) return argument.longForms[0];
+            return argument.names.empty() ? m_schema->keys[id] : argument.names[0];
+        }
+
+        /// @brief Placeholder shown after an option's name in help; empty for bool flags.
+        static const char* valueLabel(ArgType type) {
+            switch (type) {
+            case ArgType::Int: return "<int>";
+            case ArgType::Float: return "<float>";
+            case ArgType::Bool: return "";
+            case ArgType::String: return "<string>";
+            case ArgType::IntList: return "<int[]>";
+            case ArgType::FloatList: return "<float[]>";
+            case ArgType::BoolList: return "<bool[]>";
+            case ArgType::StringList: return "<string[]>";
+            default: return "<value>";
+            }
+        }
+
+        /// @brief Append an option's displayed names, e.g. "-c, --count" or "    --count".
+        static void appendOptionLabel(std::string& out, const ArgData& argument) {
+            // Prefer showing short and long forms if available; 4 spaces align a lone long form
+            if (!argument.shortForms.empty()) {
+                out.append("-").append(argument.shortForms[0]);
+                if (!argument.longForms.empty()) out.append(", --").append(argument.longForms[0]);
+            }
+            else if (!argument.longForms.empty()) {
+                out.append("    --").append(argument.longForms[0]);
+            }
+        }
+
+        /// @brief Length appendOptionLabel() would append, without building the label.
+        static size_t optionLabelSize(const ArgData& argument) {
+            size_t size = 0;
+            if (!argument.shortForms.empty()) {
+                size = 1 + argument.shortForms[0].size();
+                if (!argument.longForms.empty()) size += 4 + argument.longForms[0].size();
+            }
+            else if (!argument.longForms.empty()) {
+                size = 6 + argument.longForms[0].size();
+            }
+            return size;
+        }
+
+    private:
+        std::function<void(std::string)> m_helpHandler; ///< Function to handle help requests.
+        std::string m_header; ///< Optional header text for help output.
+        std::string m_footer; ///< Optional footer text for help output.
+        std::string m_description; ///< Optional additional description for help output.
+        mutable HelpMutex m_helpMutex; ///< Guards the help caches below.
+        mutable std::shared_ptr<const std::string> m_helpCache; ///< Rendered help, valid while m_helpRevision matches.
+        mutable std::string m_helpProgram; ///< Program name m_helpCache was rendered with.
+        mutable uint64_t m_helpRevision = 0; ///< Value of m_revision when m_helpCache was rendered.
+        mutable std::shared_ptr<const HelpIndex> m_helpIndex; ///< Search index; built by the first searchHelp().
+        mutable uint64_t m_helpIndexRevision = 0; ///< Value of m_revision when m_helpIndex was built.
+        int m_argc; ///< Argument count from main().
+        char** m_argv; ///< Argument vector from main().
+    };
+
+    namespace detail {
+        /// Type that ParseBuffer::get() returns for an argument declared as T
+        template<typename T> struct ViewOf { using type = T; };
+        template<> struct ViewOf<std::string> { using type = std::string_view; };
+        template<typename T> struct ViewOf<std::vector<T>> { using type = ListView<T>; };
+        template<> struct ViewOf<std::vector<std::string>> { using type = ListView<std::string_view>; };
+    }
+
+    /// @class ParseBuffer
+    /// @brief Reusable storage for parsing without heap allocation.
+    /// Parsing writes into storage owned by the buffer, and values are read back as views.
+    /// Strings and string lists view the parsed tokens. Numbers are converted in place. Defaults are read from the schema.
+    /// The first parse sizes the storage. Later parses and get() calls allocate nothing, unless a list is
+    /// longer than any seen before.
+    /// Validators still run. Number and bool values reach them without allocating. String and list values are
+    /// copied into an ArgValue for their validators, so validators on those types allocate.
+    /// Bound variables and struct members are not written. Help is not printed: check helpRequested().
+    /// Defaults set with defaultTo() are not computed: an absent argument with one reads as missing.
+    /// A buffer is not thread-safe; give each thread its own buffer for the same schema.
+    class ParseBuffer {
+    public:
+        /// @brief Prepare storage for parsing against a schema.
+        /// @param schema Argument definitions, usually obtained once from CliParser::schema().
+        explicit ParseBuffer(std::shared_ptr<const CliData::Schema> schema) : m_schema(std::move(schema)) {
+            size_t count = m_schema->arguments.size();
+            m_ranges.resize(count);
+            m_slots.resize(count);
+        }
+
+        /// @brief Parse tokens laid out like argv; args[0] is the program name.
+        /// The characters of the tokens are viewed, not copied: they must outlive every value read from this buffer.
+        /// The vector itself may be a temporary.
+        /// @throws Argy::Exception subclasses on errors, as CliParser::parse() does.
+        void parse(const std::vector<std::string_view>& args) {
+            ParseError error = tryParse(args);
+            if (error) error.raise();
+        }
+
+        /// @brief Parse the command line given to main(); argv must outlive every value read from this buffer.
+        /// @throws Argy::Exception subclasses on errors, as CliParser::parse() does.
+        void parse(int argc, const char* const* argv) {
+            ParseError error = tryParse(argc, argv);
+            if (error) error.raise();
+        }
+
+        /// @brief Parse tokens laid out like argv, reporting failure as a value.
+        /// @return The first error found, or an empty ParseError on success.
+        ParseError tryParse(const std::vector<std::string_view>& args) {
+            return run(args.data(), args.size());
+        }
+
+        /// @brief Parse the command line given to main(), reporting failure as a value.
+        /// @return The first error found, or an empty ParseError on success.
+        ParseError tryParse(int argc, const char* const* argv) {
+            m_argv.clear();
+            for (int i = 0; i < argc; ++i) m_argv.emplace_back(argv[i]);
+            return run(m_argv.data(), m_argv.size());
+        }
+
+        /// @brief True if the last parse stopped at -h/--help.
+        bool helpRequested() const { return m_helpRequested; }
+
+        /// @brief Schema this buffer parses against.
+        const std::shared_ptr<const CliData::Schema>& schema() const { return m_schema; }
+
+        /// @brief Read a value of the last successful parse through a typed handle.
+        /// @return int, float and bool by value; std::string_view for strings; ListView for lists.
+        /// Views stay valid until the next parse with this buffer, and no longer than the parsed tokens.
+        /// @throws UnknownArgumentException if the handle belongs to another schema.
+        /// @throws MissingArgumentException if the last parse did not succeed.
+        template<typename T>
+        typename detail::ViewOf<T>::type get(const Arg<T>& arg) const {
+            if (arg.id() >= m_slots.size() || m_schema->records[arg.id()].type != CliData::deduceArgType<T>())
+                ARGY_THROW(UnknownArgumentException("Argument handle does not belong to this parser"));
+            const Slot& slot = m_slots[arg.id()];
+            if (!slot.present)
+                ARGY_THROW(MissingArgumentException("Missing required argument: " + m_schema->keys[arg.id()]));
+            if constexpr (std::is_same_v<T, int>) return slot.intValue;
+            else if constexpr (std::is_same_v<T, float>) return slot.floatValue;
+            else if constexpr (std::is_same_v<T, bool>) return slot.boolValue;
+            else if constexpr (std::is_same_v<T, std::string>) return slot.text;
+            else {
+                using Element = typename detail::ViewOf<T>::type;
+                using E = std::remove_const_t<std::remove_pointer_t<decltype(Element().data())>>;
+                return Element(static_cast<const E*>(slot.data), slot.size);
+            }
+        }
+
+        /// @brief Read a value through a typed handle; same as get(arg).
+        template<typename T>
+        typename detail::ViewOf<T>::type operator[](const Arg<T>& arg) const { return get(arg); }
+
+    private:
+        using ArgData = CliData::ArgData;
+        using ArgType = CliData::ArgType;
+
+        /// Value of one argument; which member is used depends on the argument's type
+        struct Slot {
+            bool present{ false };
+            bool boolValue{ false };
+            int intValue{ 0 };
+            float floatValue{ 0 };
+            std::string_view text;
+            const void* data{ nullptr }; ///< First list element
+            size_t size{ 0 };            ///< List length
+        };
+
+        ParseError run(const std::string_view* args, size_t count) {
+            ParseError error;
+            m_helpRequested = false;
+            for (Slot& slot : m_slots) slot.present = false;
+            std::fill(m_ranges.begin(), m_ranges.end(), CliParser::TokenRange{});
+            if (!CliParser::lexTokens(*m_schema, args, count, m_ranges.data(), error)) {
+                if (error) error.schema = m_schema;
+                else m_helpRequested = true;
+                return error;
+            }
+
+            // Size the pools before handing out views into them
+            size_t ints = 0, floats = 0, bools = 0, strings = 0;
+            const auto& records = m_schema->records;
+            for (size_t id = 0; id < records.size(); ++id) {
+                const CliParser::TokenRange& range = m_ranges[id];
+                size_t length = range.end - range.begin;
+                if (!range.provided) {
+                    if (const auto* list = std::get_if<std::vector<bool>>(&m_schema->defaults[id])) bools += list->size();
+                    if (const auto* list = std::get_if<std::vector<std::string>>(&m_schema->defaults[id])) strings += list->size();
+                }
+                else if (records[id].type == ArgType::IntList) ints += length;
+                else if (records[id].type == ArgType::FloatList) floats += length;
+                else if (records[id].type == ArgType::BoolList) bools += length;
+                else if (records[id].type == ArgType::StringList) strings += length;
+            }
+            m_ints.resize(ints);
+            m_floats.resize(floats);
+            m_strings.resize(strings);
+            if (bools > m_boolCapacity) {
+                m_bools.reset(new bool[bools]);
+                m_boolCapacity = bools;
+            }
+            int* nextInt = m_ints.data();
+            float* nextFloat = m_floats.data();
+            bool* nextBool = m_bools.get();
+            std::string_view* nextString = m_strings.data();
+
+            for (size_t id = 0; id < records.size(); ++id) {
+                const CliParser::TokenRange& range = m_ranges[id];
+                Slot& slot = m_slots[id];
+                slot = Slot{};
+                if (!range.provided) {
+                    if (records[id].required) {
+                        error.code = ParseErrorCode::MissingArgument;
+                        error.argId = id;
+                        return fail(std::move(error));
                     }
-                    else if (!argument.shortForms.empty()) {
-                        opt = "-" + argument.shortForms[0];
+                    setDefault(m_schema->defaults[id], slot, nextBool, nextString);
+                    continue;
+                }
+                slot.present = true;
+                const std::string_view* first = args + range.begin;
+                const std::string_view* last = args + range.end;
+                size_t bad = 0;
+                ParseErrorCode code = ParseErrorCode::None;
+                switch (records[id].type) {
+                case ArgType::Int:
+                    code = CliParser::toErrorCode(CliData::toNumber(*first, slot.intValue));
+                    break;
+                case ArgType::Float:
+                    code = CliParser::toErrorCode(CliData::toNumber(*first, slot.floatValue));
+                    break;
+                case ArgType::Bool:
+                    // A flag carries no token; its presence means true
+                    slot.boolValue = first == last || *first == "true" || *first == "1";
+                    break;
+                case ArgType::String:
+                    slot.text = *first;
+                    break;
+                case ArgType::IntList:
+                    code = convertList(first, last, nextInt, slot, bad);
+                    break;
+                case ArgType::FloatList:
+                    code = convertList(first, last, nextFloat, slot, bad);
+                    break;
+                case ArgType::BoolList:
+                    slot.data = nextBool;
+                    slot.size = static_cast<size_t>(last - first);
+                    for (auto v = first; v != last; ++v) *nextBool++ = *v == "true" || *v == "1";
+                    break;
+                case ArgType::StringList:
+                    // Copy the views: args may be a temporary array, only the characters must live on
+                    slot.data = nextString;
+                    slot.size = static_cast<size_t>(last - first);
+                    nextString = std::copy(first, last, nextString);
+                    break;
+                }
+                if (code != ParseErrorCode::None) {
+                    error.code = code;
+                    error.argId = id;
+                    error.tokenIndex = range.begin + bad;
+                    error.token = args[range.begin + bad];
+                    return fail(std::move(error));
+                }
+            }
+            return validate();
+        }
+
+        /// Leave nothing readable from a parse that did not succeed
+        ParseError fail(ParseError&& error) {
+            for (Slot& slot : m_slots) slot.present = false;
+            error.schema = m_schema;
+            return std::move(error);
+        }
+
+        /// Point a slot at an argument's default, which lives in the schema
+        static void setDefault(const CliData::ArgValue& value, Slot& slot, bool*& nextBool, std::string_view*& nextString) {
+            slot.present = true;
+            if (const int* v = std::get_if<int>(&value)) slot.intValue = *v;
+            else if (const float* v = std::get_if<float>(&value)) slot.floatValue = *v;
+            else if (const bool* v = std::get_if<bool>(&value)) slot.boolValue = *v;
+            else if (const std::string* v = std::get_if<std::string>(&value)) slot.text = *v;
+            else if (const auto* list = std::get_if<std::vector<int>>(&value)) slot.data = list->data(), slot.size = list->size();
+            else if (const auto* list = std::get_if<std::vector<float>>(&value)) slot.data = list->data(), slot.size = list->size();
+            else if (const auto* list = std::get_if<std::vector<bool>>(&value)) {
+                // std::vector<bool> is packed, so its elements cannot be viewed in place
+                slot.data = nextBool;
+                slot.size = list->size();
+                for (bool b : *list) *nextBool++ = b;
+            }
+            else if (const auto* list = std::get_if<std::vector<std::string>>(&value)) {
+                slot.data = nextString;
+                slot.size = list->size();
+                for (const std::string& text : *list) *nextString++ = text;
+            }
+            else slot.present = false; // No default: reading it throws, as CliReader does
+        }
+
+        template<typename T>
+        static ParseErrorCode convertList(const std::string_view* first, const std::string_view* last, T*& next, Slot& slot, size_t& bad) {
+            slot.data = next;
+            slot.size = static_cast<size_t>(last - first);
+            for (auto v = first; v != last; ++v) {
+                ParseErrorCode code = CliParser::toErrorCode(CliData::toNumber(*v, *next++));
+                if (code != ParseErrorCode::None) {
+                    bad = static_cast<size_t>(v - first);
+                    return code;
+                }
+            }
+            return ParseErrorCode::None;
+        }
+
+        /// The value a validator sees; only strings and lists allocate
+        CliData::ArgValue valueOf(const ArgData& argument) const {
+            const Slot& slot = m_slots[argument.id];
+            if (!slot.present) return CliData::ArgValue{};
+            switch (argument.type) {
+            case ArgType::Int: return slot.intValue;
+            case ArgType::Float: return slot.floatValue;
+            case ArgType::Bool: return slot.boolValue;
+            case ArgType::String: return std::string(slot.text);
+            case ArgType::IntList: return toVector<int>(slot);
+            case ArgType::FloatList: return toVector<float>(slot);
+            case ArgType::BoolList: return toVector<bool>(slot);
+            case ArgType::StringList: {
+                auto first = static_cast<const std::string_view*>(slot.data);
+                return std::vector<std::string>(first, first + slot.size);
+            }
+            }
+            return CliData::ArgValue{};
+        }
+
+        template<typename T>
+        static std::vector<T> toVector(const Slot& slot) {
+            auto first = static_cast<const T*>(slot.data);
+            return std::vector<T>(first, first + slot.size);
+        }
+
+        ParseError validate() {
+            ParseError error;
+            for (size_t id = 0; id < m_schema->records.size(); ++id) {
+                if (!m_schema->records[id].validated) continue;
+                const ArgData* argument = &m_schema->arguments[id];
+#ifndef ARGY_NO_EXCEPTIONS
+                try {
+                    argument->validator(valueOf(*argument));
+                } catch (const std::exception& e) {
+                    error = CliParser::validationError(m_schema, *argument, e.what());
+                } catch (...) {
+                    error = CliParser::validationError(m_schema, *argument, "Validation failed for argument '" + m_schema->keys[argument->id] + "'");
+                }
+                if (error) return fail(std::move(error));
+#else
+                argument->validator(valueOf(*argument));
+#endif
+            }
+            return error;
+        }
+
+        std::shared_ptr<const CliData::Schema> m_schema;
+        std::vector<CliParser::TokenRange> m_ranges;    ///< Tokens of each argument, indexed by ArgData::id
+        std::vector<Slot> m_slots;                      ///< Value of each argument, indexed by ArgData::id
+        std::vector<std::string_view> m_argv;           ///< Tokens of the last argv parsed
+        std::vector<int> m_ints;                        ///< Elements of int lists
+        std::vector<float> m_floats;                    ///< Elements of float lists
+        std::unique_ptr<bool[]> m_bools;                ///< Elements of bool lists
+        size_t m_boolCapacity = 0;
+        std::vector<std::string_view> m_strings;        ///< Elements of string lists
+        bool m_helpRequested = false;
+    };
+
+    /// @brief Option sets fixed at compile time.
+    /// Declare options as constexpr data with option<T>() and flag(), and combine them with makeSchema().
+    /// Declared as a constexpr variable, a schema checks its names at compile time (duplicates and the
+    /// reserved -h/--help are compile errors) and builds a perfect hash over them. Parsing stores values in a
+    /// std::tuple of the declared types; nothing is registered or allocated at run time except list storage.
+    namespace Static {
+        /// @brief Marks a list option; its values are collected into a std::vector<T>.
+        template<typename T>
+        struct List {};
+
+        /// @brief Names and flags of one option, without its typed default.
+        struct Names {
+            std::string_view shortName; ///< Short form without the dash, empty if none.
+            std::string_view longName;  ///< Long form without the dashes, or the positional name.
+            std::string_view help;      ///< Help/description string.
+            std::string_view key;       ///< First declared name without dashes; used in error messages.
+            bool required{ false };     ///< True if the option must be given.
+            bool positional{ false };   ///< True for a positional argument.
+            bool isFlag{ false };       ///< True for bool options, which take no value.
+            bool isList{ false };       ///< True for List<T> options.
+        };
+
+        namespace detail {
+            template<typename T> struct ValueOf { using type = T; };
+            template<typename T> struct ValueOf<List<T>> { using type = std::vector<T>; };
+
+            template<typename T> struct IsList : std::false_type {};
+            template<typename T> struct IsList<List<T>> : std::true_type {};
+
+            template<typename T>
+            constexpr bool isElementType = std::is_same_v<T, int> || std::is_same_v<T, float> ||
+                                           std::is_same_v<T, bool> || std::is_same_v<T, std::string_view>;
+
+            // Not constexpr: reaching one of these while evaluating a constexpr schema is a compile error,
+            // and the error names the function. At run time they throw like CliBuilder::add().
+            inline void duplicateOptionName(std::string_view name) {
+                ARGY_THROW(DuplicateArgumentException("Duplicate argument name: " + std::string(name)));
+            }
+            inline void reservedOptionName(std::string_view name) {
+                ARGY_THROW(ReservedArgumentException("Cannot redefine built-in argument: " + std::string(name)));
+            }
+            inline void invalidOptionNames(std::string_view name) {
+                ARGY_THROW(InvalidArgumentException("Invalid argument names near: " + std::string(name)));
+            }
+            inline void noPerfectHash() {
+                ARGY_THROW(InvalidArgumentException("Could not build a perfect hash for the option names"));
+            }
+
+            constexpr size_t nextPow2(size_t n) {
+                size_t p = 1;
+                while (p < n) p <<= 1;
+                return p;
+            }
+
+            /// FNV-1a over a name body, seeded differently for long and short forms
+            constexpr uint64_t hashName(std::string_view body, bool isLong) {
+                uint64_t h = isLong ? 0x84222325cbf29ce4ull : 0xcbf29ce484222325ull;
+                for (char c : body) h = (h ^ static_cast<unsigned char>(c)) * 0x100000001b3ull;
+                return h;
+            }
+
+            /// splitmix64 finalizer over a name hash and a bucket's displacement
+            constexpr uint64_t mixHash(uint64_t h, uint32_t displacement) {
+                uint64_t z = h ^ (static_cast<uint64_t>(displacement) * 0x9E3779B97F4A7C15ull);
+                z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+                z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+                return z ^ (z >> 31);
+            }
+
+            constexpr Names makeNames(std::initializer_list<std::string_view> names, std::string_view help,
+                                      bool required, bool isFlag, bool isList) {
+                Names n{ {}, {}, help, {}, required, false, isFlag, isList };
+                for (std::string_view name : names) {
+                    if (name.size() > 2 && name.substr(0, 2) == "--") {
+                        if (!n.longName.empty()) invalidOptionNames(name);
+                        n.longName = name.substr(2);
                     }
-                    else if (!argument.longForms.empty()) {
-                        opt = "    --" + argument.longForms[0]; // 4 spaces for alignment
+                    else if (name.size() > 1 && name[0] == '-' && name[1] != '-') {
+                        if (!n.shortName.empty()) invalidOptionNames(name);
+                        n.shortName = name.substr(1);
                     }
-                    else if (!argument.names.empty()) {
-                        // fallback to first registered name
-                        std::string n = argument.names[0];
-                        if (startsWith(n, "--")) opt = "    " + n; else if (startsWith(n, "-")) opt = n; else opt = n;
+                    else if (!name.empty() && name[0] != '-') {
+                        if (!n.longName.empty() || !n.shortName.empty()) invalidOptionNames(name);
+                        n.longName = name;
+                        n.positional = true;
                     }
                     else {
-                        opt = "";
+                        invalidOptionNames(name);
                     }
-                    // Determine value type
-                    std::string valueType;
-                    bool isBool = false;
-                    switch (argument.type) {
-                    case ArgType::Int: valueType = "<int>"; break;
-                    case ArgType::Float: valueType = "<float>"; break;
-                    case ArgType::Bool: valueType = ""; isBool = true; break;
-                    case ArgType::String: valueType = "<string>"; break;
-                    case ArgType::IntList: valueType = "<int[]>"; break;
-                    case ArgType::FloatList: valueType = "<float[]>"; break;
-                    case ArgType::BoolList: valueType = "<bool[]>"; break;
-                    case ArgType::StringList: valueType = "<string[]>"; break;
-                    default: valueType = "<value>"; break;
-                    }
-                    if (opt.size() > maxOptNameLen) maxOptNameLen = opt.size();
-                    optNames.push_back(opt);
-                    valueTypes.push_back(valueType);
-                    isBoolFlag.push_back(isBool);
+                    if (n.key.empty()) n.key = n.longName.empty() ? n.shortName : n.longName;
                 }
+                if ((n.longName.empty() && n.shortName.empty()) || (n.positional && (n.isFlag || !n.shortName.empty())))
+                    invalidOptionNames(n.longName);
+                if (n.longName == "help") reservedOptionName("--help");
+                if (n.shortName == "h") reservedOptionName("-h");
+                return n;
             }
-            // Also consider help flag in maxOptNameLen
-            std::string helpFlag = "-h, --help";
-            if (helpFlag.size() > maxOptNameLen) maxOptNameLen = helpFlag.size();
+        }
 
-            // Find max width for value type
-            size_t maxTypeLen = 0;
-            for (const auto& vt : valueTypes) {
-                if (vt.size() > maxTypeLen) maxTypeLen = vt.size();
+        /// @brief One compile-time option declaration; create it with option<T>() or flag().
+        /// @tparam T int, float, bool, std::string_view, or List<> of one of those.
+        template<typename T>
+        struct Option {
+            using value_type = typename detail::ValueOf<T>::type; ///< Type stored in parse results.
+            Names names;     ///< Names and flags.
+            T defaultValue;  ///< Value when not given; unused for required options.
+        };
+
+        /// @brief Declare a required option.
+        /// @param names Names such as {"-n", "--count"}, or a single positional name such as {"file"}.
+        /// @param help Help text for usage.
+        template<typename T>
+        constexpr Option<T> option(std::initializer_list<std::string_view> names, std::string_view help) {
+            static_assert(detail::isElementType<T> || detail::IsList<T>::value,
+                          "Static options must be int, float, bool, std::string_view or a List of those");
+            return Option<T>{ detail::makeNames(names, help, !std::is_same_v<T, bool>, std::is_same_v<T, bool>,
+                                                detail::IsList<T>::value), T{} };
+        }
+
+        /// @brief Declare an optional option with a default value.
+        template<typename T>
+        constexpr Option<T> option(std::initializer_list<std::string_view> names, std::string_view help, T defaultValue) {
+            Option<T> opt = option<T>(names, help);
+            opt.names.required = false;
+            opt.defaultValue = defaultValue;
+            return opt;
+        }
+
+        /// @brief Declare a required option with a single name.
+        template<typename T>
+        constexpr Option<T> option(std::string_view name, std::string_view help) {
+            return option<T>({ name }, help);
+        }
+
+        /// @brief Declare an optional option with a single name and a default value.
+        template<typename T>
+        constexpr Option<T> option(std::string_view name, std::string_view help, T defaultValue) {
+            return option<T>({ name }, help, defaultValue);
+        }
+
+        /// @brief Declare a bool flag; it is false unless given.
+        constexpr Option<bool> flag(std::initializer_list<std::string_view> names, std::string_view help) {
+            return option<bool>(names, help, false);
+        }
+
+        /// @brief Declare a bool flag with a single name.
+        constexpr Option<bool> flag(std::string_view name, std::string_view help) {
+            return option<bool>({ name }, help, false);
+        }
+
+        /// @class Schema
+        /// @brief A fixed set of options with a compile-time perfect hash over their names.
+        /// @tparam Ts Declared option types, in declaration order.
+        template<typename... Ts>
+        class Schema {
+        public:
+            static constexpr size_t count = sizeof...(Ts); ///< Number of options.
+            using Values = std::tuple<typename Option<Ts>::value_type...>; ///< Parsed values, one per option.
+
+            /// @brief Outcome of parsing one command line.
+            struct Result {
+                Values values;                   ///< Parsed or default value of each option, in declaration order.
+                std::array<bool, count> given{}; ///< Whether each option appeared on the command line.
+                bool helpRequested = false;      ///< True if parsing stopped at -h/--help.
+
+                /// @brief Value of the I-th option, e.g. result.get<schema.indexOf("count")>().
+                template<size_t I>
+                const auto& get() const { return std::get<I>(values); }
+
+                /// @brief True if the I-th option appeared on the command line.
+                template<size_t I>
+                bool has() const { return given[I]; }
+            };
+
+            /// @brief Build the schema; duplicate or reserved names stop compilation for a constexpr schema.
+            constexpr explicit Schema(const Option<Ts>&... options)
+                : m_options(options...), m_names{ { options.names... } } {
+                checkNames();
+                buildIndex();
             }
 
-            // Print options with aligned <value> and help text
-            size_t optIdx = 0;
-            for (const auto& [key, argument] : m_arguments) {
-                if (!argument.positional) {
-                    std::string opt = optNames[optIdx];
-                    std::string valueType = valueTypes[optIdx];
-                    bool isBool = isBoolFlag[optIdx++];
-                    std::cout << "  " << green << opt << reset;
-                    size_t padName = maxOptNameLen > opt.size() ? maxOptNameLen - opt.size() : 0;
-                    std::cout << std::string(padName, ' ');
-                    if (!isBool && !valueType.empty()) {
-                        std::cout << " " << gray << valueType << reset;
-                        size_t padType = maxTypeLen > valueType.size() ? maxTypeLen - valueType.size() : 0;
-                        std::cout << std::string(padType, ' ');
+            /// @brief Index of the option with the given name (with or without dashes), or count if none.
+            constexpr size_t indexOf(std::string_view name) const {
+                std::string_view body = name.substr(0, 2) == "--" ? name.substr(2)
+                                      : name.substr(0, 1) == "-" ? name.substr(1) : name;
+                for (size_t i = 0; i < count; ++i) {
+                    if (m_names[i].longName == body || m_names[i].shortName == body) return i;
+                }
+                return count;
+            }
+
+            /// @brief Names and flags of the I-th option.
+            constexpr const Names& names(size_t index) const { return m_names[index]; }
+
+            /// @brief Parse the command line given to main().
+            /// String values are views into argv, which must outlive the result.
+            /// @throws Argy::Exception subclasses on errors, as CliParser::parse() does.
+            Result parse(int argc, const char* const* argv) const {
+                return parseTokens(argc > 0 ? static_cast<size_t>(argc) : 0,
+                                   [argv](size_t i) { return std::string_view(argv[i]); });
+            }
+
+            /// @brief Parse a tokenized command line; args[0] is the program name.
+            /// String values are views into the tokens, which must outlive the result.
+            /// @throws Argy::Exception subclasses on errors, as CliParser::parse() does.
+            Result parse(const std::vector<std::string_view>& args) const {
+                return parseTokens(args.size(), [&args](size_t i) { return args[i]; });
+            }
+
+            /// @brief Write a plain usage summary.
+            void printHelp(std::ostream& os, std::string_view programName) const {
+                os << "Usage: " << programName << " [options]";
+                for (const Names& n : m_names)
+                    if (n.positional) os << " <" << n.longName << ">";
+                os << "\n\nOptions:\n";
+                for (const Names& n : m_names) {
+                    std::string label = n.positional ? std::string(n.longName)
+                        : (n.shortName.empty() ? std::string("    ") : "-" + std::string(n.shortName) + (n.longName.empty() ? "  " : ", "))
+                          + (n.longName.empty() ? std::string() : "--" + std::string(n.longName));
+                    os << "  " << label << std::string(label.size() < 24 ? 24 - label.size() : 1, ' ') << n.help
+                       << (n.required ? " (required)" : "") << "\n";
+                }
+                os << "  -h, --help" << std::string(14, ' ') << "Show this help message\n";
+            }
+
+        private:
+            static constexpr size_t maxKeys = 2 * count + 1;
+            static constexpr size_t bucketCount = detail::nextPow2(count + 1);
+            static constexpr size_t slotCount = detail::nextPow2(4 * count + 2);
+
+            /// Hash table entry: a name, whether it is the long form, and its option index (-1 if empty)
+            struct Slot {
+                std::string_view name;
+                bool isLong = false;
+                int option = -1;
+            };
+
+            constexpr void checkNames() {
+                for (size_t i = 0; i < count; ++i) {
+                    for (size_t j = 0; j < i; ++j) {
+                        const Names& a = m_names[i];
+                        const Names& b = m_names[j];
+                        // Names are compared without dashes, as CliBuilder::add() does
+                        if (!a.longName.empty() && (a.longName == b.longName || a.longName == b.shortName))
+                            detail::duplicateOptionName(a.longName);
+                        if (!a.shortName.empty() && (a.shortName == b.shortName || a.shortName == b.longName))
+                            detail::duplicateOptionName(a.shortName);
                     }
-                    else {
-                        std::cout << std::string(maxTypeLen + 1, ' '); // +1 for space before type
+                }
+            }
+
+            /// Hash-and-displace construction: every name hashes to a bucket, and each bucket gets the
+            /// smallest displacement that sends all of its names to free slots. Lookup is then one hash,
+            /// one table read and one string compare.
+            constexpr void buildIndex() {
+                std::array<Slot, maxKeys> keys{};
+                std::array<uint64_t, maxKeys> hashes{};
+                size_t keyCount = 0;
+                for (size_t i = 0; i < count; ++i) {
+                    const Names& n = m_names[i];
+                    if (!n.shortName.empty()) keys[keyCount++] = Slot{ n.shortName, false, static_cast<int>(i) };
+                    if (!n.longName.empty()) keys[keyCount++] = Slot{ n.longName, true, static_cast<int>(i) };
+                }
+                std::array<size_t, bucketCount> bucketSize{};
+                for (size_t k = 0; k < keyCount; ++k) {
+                    hashes[k] = detail::hashName(keys[k].name, keys[k].isLong);
+                    ++bucketSize[hashes[k] & (bucketCount - 1)];
+                }
+                std::array<bool, bucketCount> placed{};
+                for (size_t round = 0; round < bucketCount; ++round) {
+                    // Largest buckets first, while the table is emptiest
+                    size_t bucket = 0;
+                    for (size_t b = 0; b < bucketCount; ++b) {
+                        if (!placed[b] && (placed[bucket] || bucketSize[b] > bucketSize[bucket])) bucket = b;
                     }
-                    // Help message starts here
-                    if (!argument.help.empty())
-                        std::cout << "  " << argument.help;
-                    if (!std::holds_alternative<std::monostate>(argument.defaultValue))
-                        std::cout << gray << " (default: " << toString(argument.defaultValue) << ")" << reset;
-                    if (argument.required) {
-                        std::cout << " " << yellow << "(required)" << reset;
+                    placed[bucket] = true;
+                    if (bucketSize[bucket] == 0) continue;
+                    for (uint32_t d = 0;; ++d) {
+                        if (d == (1u << 20)) {
+                            detail::noPerfectHash();
+                            return;
+                        }
+                        bool fits = true;
+                        for (size_t k = 0; k < keyCount && fits; ++k) {
+                            if ((hashes[k] & (bucketCount - 1)) != bucket) continue;
+                            size_t slot = detail::mixHash(hashes[k], d) & (slotCount - 1);
+                            fits = m_slots[slot].option < 0;
+                            for (size_t j = 0; j < k && fits; ++j) {
+                                fits = (hashes[j] & (bucketCount - 1)) != bucket ||
+                                       (detail::mixHash(hashes[j], d) & (slotCount - 1)) != slot;
+                            }
+                        }
+                        if (!fits) continue;
+                        for (size_t k = 0; k < keyCount; ++k) {
+                            if ((hashes[k] & (bucketCount - 1)) == bucket)
+                                m_slots[detail::mixHash(hashes[k], d) & (slotCount - 1)] = keys[k];
+                        }
+                        m_displacement[bucket] = d;
+                        break;
                     }
-                    std::cout << "\n";
-                    // Print aliases (remaining registered names) beneath the main option line
-                    std::vector<std::string> aliases;
-                    std::string displayedShort = !argument.shortForms.empty() ? argument.shortForms[0] : std::string();
-                    std::string displayedLong = !argument.longForms.empty() ? argument.longForms[0] : std::string();
-                    // collect short form aliases (preserve single-dash)
-                    for (const auto& s : argument.shortForms) {
-                        if (s == displayedShort) continue;
-                        aliases.push_back(std::string("-") + s);
+                }
+            }
+
+            /// Option index for a flag name without dashes, or -1
+            int find(std::string_view body, bool isLong) const {
+                uint64_t h = detail::hashName(body, isLong);
+                const Slot& slot = m_slots[detail::mixHash(h, m_displacement[h & (bucketCount - 1)]) & (slotCount - 1)];
+                return (slot.option >= 0 && slot.isLong == isLong && slot.name == body) ? slot.option : -1;
+            }
+
+            /// Call fn(std::integral_constant<size_t, I>) for I == index; compiles to a switch over the options
+            template<typename F, size_t... Is>
+            static void dispatch(size_t index, F&& fn, std::index_sequence<Is...>) {
+                (void)((index == Is && (fn(std::integral_constant<size_t, Is>{}), true)) || ...);
+            }
+
+            template<typename F>
+            static void dispatch(size_t index, F&& fn) {
+                dispatch(index, std::forward<F>(fn), std::index_sequence_for<Ts...>{});
+            }
+
+            template<size_t... Is>
+            Values defaults(std::index_sequence<Is...>) const {
+                return Values{ defaultOf(std::get<Is>(m_options))... };
+            }
+
+            template<typename T>
+            static typename Option<T>::value_type defaultOf(const Option<T>& opt) {
+                if constexpr (detail::IsList<T>::value) return {};
+                else return opt.defaultValue;
+            }
+
+            std::string displayName(size_t index) const { return std::string(m_names[index].key); }
+
+            /// Convert one token into an element; throws as CliParser::parse() does for the same input
+            template<typename E>
+            void convert(size_t index, std::string_view token, E& out) const {
+                bool list = m_names[index].isList;
+                if constexpr (std::is_same_v<E, std::string_view>) {
+                    out = token;
+                }
+                else if constexpr (std::is_same_v<E, bool>) {
+                    out = token == "true" || token == "1";
+                }
+                else {
+                    std::errc ec = CliData::toNumber(token, out);
+                    if (ec == std::errc::result_out_of_range && !list)
+                        ARGY_THROW(OutOfRangeException("Value out of range for argument '" + displayName(index) + "': " + std::string(token)));
+                    if (ec == std::errc::result_out_of_range)
+                        ARGY_THROW(InvalidValueException("Value out of range in list for argument '" + displayName(index) + "': " + std::string(token)));
+                    if (ec != std::errc())
+                        ARGY_THROW(InvalidValueException((list ? "Invalid value in list for argument '" : "Invalid value for argument '") +
+                                                         displayName(index) + "': " + std::string(token)));
+                }
+            }
+
+            void store(Result& result, size_t index, std::string_view token) const {
+                result.given[index] = true;
+                dispatch(index, [&](auto I) {
+                    auto& value = std::get<decltype(I)::value>(result.values);
+                    using V = std::decay_t<decltype(value)>;
+                    if constexpr (CliData::is_vector<V>::value) {
+                        typename V::value_type element{};
+                        convert(index, token, element);
+                        value.push_back(element);
                     }
-                    // collect long form aliases (preserve double-dash)
-                    for (const auto& l : argument.longForms) {
-                        if (l == displayedLong) continue;
-                        aliases.push_back(std::string("--") + l);
+                    else {
+                        convert(index, token, value);
                     }
-                    // any remaining names not captured in shortForms/longForms: guess dash based on length
-                    for (const auto& n : argument.names) {
-                        bool inShort = std::find(argument.shortForms.begin(), argument.shortForms.end(), n) != argument.shortForms.end();
-                        bool inLong = std::find(argument.longForms.begin(), argument.longForms.end(), n) != argument.longForms.end();
-                        if (inShort || inLong) continue;
-                        if (n.size() == 1) aliases.push_back(std::string("-") + n);
-                        else aliases.push_back(std::string("--") + n);
+                });
+            }
+
+            template<typename TokenAt>
+            Result parseTokens(size_t argc, TokenAt tokenAt) const {
+                Result result{ defaults(std::index_sequence_for<Ts...>{}), {}, false };
+                size_t current = count; // option waiting for its value(s); count if none
+                size_t positional = 0;
+                bool positionalOnly = false;
+                for (size_t i = 1; i < argc; ++i) {
+                    std::string_view token = tokenAt(i);
+                    CliData::TokenKind kind = positionalOnly ? CliData::TokenKind::Value : CliData::classifyToken(token);
+                    switch (kind) {
+                    case CliData::TokenKind::Separator:
+                        positionalOnly = true;
+                        break;
+                    case CliData::TokenKind::LongFlag:
+                    case CliData::TokenKind::ShortFlag: {
+                        if (token == "--help" || token == "-h") {
+                            result.helpRequested = true;
+                            return result;
+                        }
+                        bool isLong = kind == CliData::TokenKind::LongFlag;
+                        int found = find(token.substr(isLong ? 2 : 1), isLong);
+                        if (found < 0)
+                            ARGY_THROW(UnknownArgumentException((isLong ? "Unknown argument: " : "Unknown short argument: ") + std::string(token)));
+                        current = static_cast<size_t>(found);
+                        if (m_names[current].isList) {
+                            // A repeated list flag starts the list over
+                            result.given[current] = true;
+                            dispatch(current, [&](auto I) {
+                                auto& value = std::get<decltype(I)::value>(result.values);
+                                if constexpr (CliData::is_vector<std::decay_t<decltype(value)>>::value) value.clear();
+                            });
+                        }
+                        else if (m_names[current].isFlag) {
+                            result.given[current] = true;
+                            dispatch(current, [&](auto I) {
+                                auto& value = std::get<decltype(I)::value>(result.values);
+                                if constexpr (std::is_same_v<std::decay_t<decltype(value)>, bool>) value = true;
+                            });
+                            current = count;
+                        }
+                        break;
                     }
-                    if (!aliases.empty()) {
-                        std::string aliasList;
-                        for (size_t ai = 0; ai < aliases.size(); ++ai) {
-                            if (ai > 0) aliasList += ", ";
-                            aliasList += aliases[ai];
+                    case CliData::TokenKind::NegativeNumber:
+                    case CliData::TokenKind::Value:
+                        if (current < count && !positionalOnly) {
+                            store(result, current, token);
+                            if (!m_names[current].isList) current = count;
                         }
-                        std::cout << gray << "  alias: [" << green << aliasList << reset << "] \n";
+                        else {
+                            while (positional < count && !m_names[positional].positional) ++positional;
+                            if (positional == count)
+                                ARGY_THROW(UnexpectedPositionalArgumentException("Unexpected positional argument: " + std::string(token)));
+                            store(result, positional++, token);
+                        }
+                        break;
                     }
                 }
+                for (size_t i = 0; i < count; ++i) {
+                    if (m_names[i].required && !result.given[i])
+                        ARGY_THROW(MissingArgumentException((m_names[i].isList ? "Missing required list argument: " : "Missing required argument: ") + displayName(i)));
+                }
+                return result;
             }
-            // Help flag, aligned
-            size_t helpPadName = maxOptNameLen > helpFlag.size() ? maxOptNameLen - helpFlag.size() : 0;
-            std::cout << "  " << green << helpFlag << reset << std::string(helpPadName, ' ') << std::string(maxTypeLen + 1, ' ') << "  Show this help message\n";
-            
-            // Footer
-            if (!m_footer.empty())
-                std::cout << "\n" << m_footer << "\n"; 
-        }
 
-    private:
-        std::function<void(std::string)> m_helpHandler; ///< Function to handle help requests.
-        std::string m_header; ///< Optional header text for help output.
-        std::string m_footer; ///< Optional footer text for help output.
-        std::string m_description; ///< Optional additional description for help output.
-        int m_argc; ///< Argument count from main().
-        char** m_argv; ///< Argument vector from main().
-    };
-}
\ No newline at end of file
+            std::tuple<Option<Ts>...> m_options;
+            std::array<Names, count> m_names;
+            std::array<Slot, slotCount> m_slots{};
+            std::array<uint32_t, bucketCount> m_displacement{};
+        };
+
+        /// @brief Combine option declarations into a schema.
+        /// Declare the result constexpr so that invalid names are reported at compile time:
+        /// @code
+        /// constexpr auto schema = Argy::Static::makeSchema(
+        ///     Argy::Static::option<int>({"-n", "--count"}, "Number of items", 10),
+        ///     Argy::Static::flag({"-v", "--verbose"}, "Verbose output"));
+        /// @endcode
+        template<typename... Ts>
+        constexpr Schema<Ts...> makeSchema(const Option<Ts>&... options) {
+            return Schema<Ts...>(options...);
+        }
+    }
+}
@@ -0,0 +1,104 @@
+// ParseBuffer must not touch the heap once warmed up; global operator new is counted to check it
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "argy.hpp"
+#include <doctest.h>
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace {
+    std::atomic<size_t> allocations{ 0 };
+}
+
+void* operator new(std::size_t size) {
+    ++allocations;
+    if (void* p = std::malloc(size ? size : 1)) return p;
+    throw std::bad_alloc();
+}
+void* operator new[](std::size_t size) { return operator new(size); }
+
+// GCC pairs these frees with the malloc inlined from operator new above and reports a mismatch
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+void operator delete[](void* p) noexcept { std::free(p); }
+void operator delete[](void* p, std::size_t) noexcept { std::free(p); }
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+using namespace Argy;
+
+TEST_CASE("ParseBuffer parses and reads values without allocating") {
+    CliParser cli(0, nullptr);
+    Arg<std::string> input = cli.addString("input", "Input file");
+    Arg<int> batch = cli.addInt({"-b", "--batch-size-for-the-writer"}, "Rows per batch", 64).isInRange(1, 4096);
+    Arg<float> ratio = cli.addFloat({"-r", "--sampling-ratio-of-the-reader"}, "Sampling ratio", 0.5f);
+    Arg<bool> verbose = cli.addBool({"-v", "--verbose-diagnostic-output"}, "Verbose output");
+    Arg<std::vector<int>> ids = cli.addInts({"-i", "--identifiers-to-process"}, "Ids", Ints{});
+    Arg<std::vector<float>> weights = cli.addFloats("--weights", "Weights", Floats{1.0f, 2.5f});
+    Arg<std::vector<std::string>> files = cli.addStrings({"-f", "--additional-input-files"}, "Files", Strings{"a", "b"});
+    Arg<std::vector<bool>> switches = cli.addBools("--switches", "Switches", Bools{true, false, true});
+    Arg<std::string> mode = cli.addString("--mode", "Mode", "fast");
+
+    ParseBuffer buffer(cli.schema());
+    std::vector<std::string_view> args = {
+        "prog", "data.csv", "--batch-size-for-the-writer", "128", "--sampling-ratio-of-the-reader", "0.25",
+        "--verbose-diagnostic-output", "--identifiers-to-process", "1", "2", "3", "-f", "x", "y"
+    };
+    buffer.parse(args); // Sizes the buffer's storage
+
+    size_t before = allocations.load();
+    int total = 0;
+    for (int round = 0; round < 100; ++round) {
+        buffer.parse(args);
+        total += buffer.get(batch) + static_cast<int>(buffer.get(ids).size());
+        total += buffer.get(verbose) ? 1 : 0;
+        total += static_cast<int>(buffer.get(input).size() + buffer.get(files).size() + buffer.get(mode).size());
+        total += static_cast<int>(buffer.get(ratio) * 4 + buffer.get(weights)[1] * 2 + buffer.get(switches).size());
+    }
+    CHECK(allocations.load() == before);
+    CHECK(total == 100 * (128 + 3 + 1 + 8 + 2 + 4 + 1 + 5 + 3));
+
+    CHECK(buffer.get(input) == "data.csv");
+    CHECK(buffer.get(ids)[2] == 3);
+    CHECK(buffer.get(files)[1] == "y");
+    CHECK(buffer.get(switches)[2]);
+    CHECK(buffer.get(mode) == "fast");
+}
+
+TEST_CASE("ParseBuffer parses argv without allocating") {
+    CliParser cli(0, nullptr);
+    Arg<std::string> input = cli.addString("input", "Input file");
+    Arg<int> batch = cli.addInt({"-b", "--batch-size"}, "Rows per batch", 64);
+    Arg<std::vector<int>> ids = cli.addInts("--ids", "Ids", Ints{});
+
+    const char* argv[] = { "prog", "data.csv", "-b", "128", "--ids", "1", "2", "3" };
+    const int argc = static_cast<int>(sizeof(argv) / sizeof(argv[0]));
+    ParseBuffer buffer(cli.schema());
+    buffer.parse(argc, argv); // Sizes the buffer's storage
+
+    size_t before = allocations.load();
+    int total = 0, failures = 0;
+    for (int round = 0; round < 100; ++round) {
+        if (buffer.tryParse(argc, argv)) ++failures;
+        total += buffer.get(batch) + static_cast<int>(buffer.get(ids).size() + buffer.get(input).size());
+    }
+    CHECK(allocations.load() == before);
+    CHECK(failures == 0);
+    CHECK(total == 100 * (128 + 3 + 8));
+}
+
+TEST_CASE("Empty results do not allocate") {
+    ParsedArgs warm; // The shared empty schema is created once
+    size_t before = allocations.load();
+    std::vector<ParseResult> results(64);
+    CHECK(allocations.load() == before + 1); // the vector's own storage
+    ParsedArgs empty;
+    CHECK(allocations.load() == before + 1);
+    CHECK(empty.schema()->arguments.empty());
+    CHECK(results[0].args.schema() == warm.schema());
+}
@@ -5,6 +5,9 @@
 #include <string>
 #include <filesystem>
 #include <fstream>
+#include <sstream>
+#include <cstdio>
+#include <memory_resource>
 
 using namespace Argy;
 namespace fs = std::filesystem;
@@ -345,6 +348,14 @@ TEST_CASE("Duplicate argument names throws") {
     CliParser parser(0, nullptr);
     parser.addString("filename", "Input file");
     CHECK_THROWS_AS(parser.addString("filename", "Duplicate"), Argy::DuplicateArgumentException);
+
+    // Every alias is checked, whatever its dashes, and a rejected add leaves the schema unchanged
+    for (int i = 0; i < 1000; ++i) parser.addInt({"--opt-" + std::to_string(i), "--alias-" + std::to_string(i)}, "Option", i);
+    CHECK_THROWS_AS(parser.addInt({"--new", "--alias-500"}, "Duplicate", 0), Argy::DuplicateArgumentException);
+    CHECK_THROWS_AS(parser.addInt("-opt-999", "Duplicate", 0), Argy::DuplicateArgumentException);
+    CHECK_THROWS_AS(parser.addInt("--filename", "Duplicate", 0), Argy::DuplicateArgumentException);
+    CHECK_NOTHROW(parser.addInt("--new", "Not a duplicate", 0));
+    CHECK(parser.schema()->arguments.size() == 1002);
 }
 
 TEST_CASE("Reserved names throws") {
@@ -1139,3 +1150,813 @@ TEST_CASE("POSIX style -- delimiter for positional arguments") {
         CHECK(parser.getString("input") == "file.txt");
     }
 }
+
+TEST_CASE("Parse tokens from a caller-owned buffer") {
+    std::string line = "prog input.txt --count 7 --names Alice Bob -v";
+    std::vector<std::string_view> tokens;
+    size_t pos = 0;
+    while (pos < line.size()) {
+        size_t end = line.find(' ', pos);
+        if (end == std::string::npos) end = line.size();
+        tokens.emplace_back(line.data() + pos, end - pos);
+        pos = end + 1;
+    }
+    CliParser parser(0, nullptr);
+    parser.addString("filename", "Input file");
+    parser.addInt({"-c", "--count"}, "Count", 1);
+    parser.addStrings({"-n", "--names"}, "Names", Strings{});
+    parser.addBool({"-v", "--verbose"}, "Verbose");
+    auto args = parser.parse(tokens);
+    line.assign(line.size(), 'x'); // values must not depend on the buffer after parse()
+    CHECK(args.getString("filename") == "input.txt");
+    CHECK(args.getInt("count") == 7);
+    CHECK(args.getStrings("names") == Strings{"Alice", "Bob"});
+    CHECK(args.getBool("verbose") == true);
+}
+
+TEST_CASE("One parser parses many command lines without stale values") {
+    CliParser parser(0, nullptr);
+    parser.addInt({"-c", "--count"}, "Count", 1);
+    parser.addBool({"-v", "--verbose"}, "Verbose");
+    parser.addStrings({"-n", "--names"}, "Names", Strings{});
+
+    auto first = parser.parse({"prog", "--count", "5", "-v", "--names", "a", "b"});
+    auto second = parser.parse({"prog"});
+    CHECK(first.getInt("count") == 5);
+    CHECK(first.getBool("verbose") == true);
+    CHECK(first.getStrings("names") == Strings{"a", "b"});
+    CHECK(second.getInt("count") == 1);
+    CHECK(second.getBool("verbose") == false);
+    CHECK(second.getStrings("names").empty());
+    CHECK(parser.getInt("count") == 1);
+
+    // A help request parses nothing, so it must not hand back the previous values
+    parser.setHelpHandler([](const std::string&) {});
+    parser.parse({"prog", "--count", "7"});
+    auto help = parser.parse({"prog", "--help"});
+    CHECK(help.helpRequested());
+    CHECK(help.getInt("count") == 1);
+    CHECK_FALSE(help.has("count"));
+}
+
+TEST_CASE("Parse results share the schema instead of copying it") {
+    CliParser parser(0, nullptr);
+    parser.addInt({"-c", "--count"}, "Count", 1);
+    auto first = parser.parse({"prog", "-c", "2"});
+    auto second = parser.parse({"prog", "-c", "3"});
+    CHECK(first.schema() == parser.schema());
+    CHECK(second.schema() == parser.schema());
+
+    // Adding an argument afterwards leaves earlier results untouched
+    parser.addInt("--extra", "Extra", 0);
+    CHECK(first.schema() != parser.schema());
+    CHECK_THROWS_AS(first.getInt("extra"), Argy::UnknownArgumentException);
+    CHECK(parser.parse({"prog", "--extra", "4"}).getInt("extra") == 4);
+    CHECK(first.getInt("count") == 2);
+
+    // Moving a parser keeps its schema whole, though CliData is reached through two bases
+    CliParser moved(0, nullptr);
+    moved = std::move(parser);
+    CHECK(moved.parse({"prog", "--extra", "5"}).getInt("extra") == 5);
+    first = std::move(second);
+    CHECK(first.getInt("count") == 3);
+}
+
+TEST_CASE("Numeric conversion rejects partial matches") {
+    CliParser parser(0, nullptr);
+    parser.addInt({"-c", "--count"}, "Count", 1);
+    parser.addFloat({"-r", "--rate"}, "Rate", 1.0f);
+    parser.addInts({"-i", "--ids"}, "Ids", Ints{});
+    CHECK_THROWS_AS(parser.parse({"prog", "--count", "12abc"}), Argy::InvalidValueException);
+    CHECK_THROWS_AS(parser.parse({"prog", "--rate", "1.5x"}), Argy::InvalidValueException);
+    CHECK_THROWS_AS(parser.parse({"prog", "--ids", "1", "2x", "3"}), Argy::InvalidValueException);
+    CHECK_THROWS_AS(parser.parse({"prog", "--count", ""}), Argy::InvalidValueException);
+    CHECK_THROWS_AS(parser.parse({"prog", "--count", "99999999999"}), Argy::OutOfRangeException);
+    CHECK_THROWS_AS(parser.parse({"prog", "--ids", "99999999999"}), Argy::InvalidValueException);
+}
+
+TEST_CASE("Numeric conversion accepts signs and exponents") {
+    CliParser parser(0, nullptr);
+    parser.addInt({"-c", "--count"}, "Count", 1);
+    parser.addFloats({"-w", "--weights"}, "Weights", Floats{});
+    auto args = parser.parse({"prog", "--count", "+42", "--weights", "-0.5", "+2", "1e3", ".25"});
+    CHECK(args.getInt("count") == 42);
+    CHECK(args.getFloats("weights") == Floats{-0.5f, 2.0f, 1000.0f, 0.25f});
+    CHECK(parser.parse({"prog", "-c", "-7"}).getInt("count") == -7);
+}
+
+TEST_CASE("Token classifier") {
+    using Kind = CliData::TokenKind;
+    CHECK(CliData::classifyToken("--verbose") == Kind::LongFlag);
+    CHECK(CliData::classifyToken("--") == Kind::Separator);
+    CHECK(CliData::classifyToken("-v") == Kind::ShortFlag);
+    CHECK(CliData::classifyToken("-1a") == Kind::ShortFlag);
+    CHECK(CliData::classifyToken("-e5") == Kind::ShortFlag);
+    CHECK(CliData::classifyToken("-42") == Kind::NegativeNumber);
+    CHECK(CliData::classifyToken("-3.5") == Kind::NegativeNumber);
+    CHECK(CliData::classifyToken("-.5") == Kind::NegativeNumber);
+    CHECK(CliData::classifyToken("-1e-3") == Kind::NegativeNumber);
+    CHECK(CliData::classifyToken("-inf") == Kind::NegativeNumber);
+    CHECK(CliData::classifyToken("-1e") == Kind::ShortFlag);
+    CHECK(CliData::classifyToken("-") == Kind::Value);
+    CHECK(CliData::classifyToken("") == Kind::Value);
+    CHECK(CliData::classifyToken("file.txt") == Kind::Value);
+}
+
+TEST_CASE("Negative numbers are values, not flags") {
+    CliParser parser(0, nullptr);
+    parser.addInts({"-o", "--offsets"}, "Offsets", Ints{});
+    parser.addFloat({"-s", "--scale"}, "Scale", 1.0f);
+    auto args = parser.parse({"prog", "--offsets", "-1", "-20", "3", "-s", "-1e-3"});
+    CHECK(args.getInts("offsets") == Ints{-1, -20, 3});
+    CHECK(args.getFloat("scale") == doctest::Approx(-0.001f));
+}
+
+TEST_CASE("tryParse reports errors as values") {
+    CliParser parser(0, nullptr);
+    parser.addString("input", "Input file");
+    parser.addInt({"-c", "--count"}, "Count", 1).isInRange(1, 10);
+    parser.addInts({"-i", "--ids"}, "Ids", Ints{});
+    auto schema = parser.schema();
+
+    auto ok = CliParser::tryParse(schema, {"prog", "in.txt", "-c", "3"});
+    CHECK(ok.ok());
+    CHECK(ok.args.getInt("count") == 3);
+
+    auto unknown = CliParser::tryParse(schema, {"prog", "in.txt", "--bogus"});
+    CHECK(unknown.error.code == ParseErrorCode::UnknownArgument);
+    CHECK(unknown.error.tokenIndex == 2);
+    CHECK(unknown.message() == "Unknown argument: --bogus");
+
+    auto missing = CliParser::tryParse(schema, {"prog"});
+    CHECK(missing.error.code == ParseErrorCode::MissingArgument);
+    CHECK(missing.error.argId == schema->find("input")->id);
+    CHECK(missing.message() == "Missing required argument: input");
+
+    auto invalid = CliParser::tryParse(schema, {"prog", "in.txt", "--ids", "1", "x2"});
+    CHECK(invalid.error.code == ParseErrorCode::InvalidValue);
+    CHECK(invalid.error.tokenIndex == 4);
+    CHECK(invalid.error.token == "x2");
+    CHECK_THROWS_AS(invalid.error.raise(), Argy::InvalidValueException);
+
+    auto overflow = CliParser::tryParse(schema, {"prog", "in.txt", "-c", "99999999999"});
+    CHECK(overflow.error.code == ParseErrorCode::OutOfRange);
+    CHECK_THROWS_AS(overflow.error.raise(), Argy::OutOfRangeException);
+
+    auto rejected = CliParser::tryParse(schema, {"prog", "in.txt", "-c", "11"});
+    CHECK(rejected.error.code == ParseErrorCode::ValidationFailed);
+    CHECK(rejected.error.argId == schema->find("count")->id);
+    CHECK(rejected.message().find("out of range") != std::string::npos);
+    CHECK_THROWS_AS(rejected.error.raise(), Argy::OutOfRangeException);
+
+    auto extra = CliParser::tryParse(schema, {"prog", "a", "b"});
+    CHECK(extra.error.code == ParseErrorCode::UnexpectedPositional);
+    CHECK(extra.message() == "Unexpected positional argument: b");
+
+    CHECK(CliParser::tryParse(schema, {"prog", "-h"}).args.helpRequested());
+}
+
+TEST_CASE("Regex validators compile their pattern once") {
+    auto first = Argy::detail::compiledRegex("[a-z]+");
+    auto second = Argy::detail::compiledRegex("[a-z]+");
+    CHECK(first == second);
+
+    CliParser parser(0, nullptr);
+    parser.addString("--token", "Token", "abc").isMatch("[a-z]+");
+    CHECK_THROWS_AS(parser.addString("--bad", "Bad pattern", "x").isMatch("[a-z"), std::regex_error);
+    for (int i = 0; i < 3; ++i) {
+        CHECK(parser.parse({"prog", "--token", "xyz"}).getString("token") == "xyz");
+        CHECK_THROWS_AS(parser.parse({"prog", "--token", "XYZ"}), Argy::InvalidValueException);
+    }
+}
+
+TEST_CASE("Address and identifier parsers return the binary form") {
+    CHECK(Argy::parseIPv4("192.168.1.254") == IPv4Bytes{192, 168, 1, 254});
+    CHECK_FALSE(Argy::parseIPv4("256.1.1.1"));
+    CHECK_FALSE(Argy::parseIPv4("01.1.1.1"));
+    CHECK_FALSE(Argy::parseIPv4("1.1.1"));
+
+    IPv6Bytes loopback{};
+    loopback[15] = 1;
+    CHECK(Argy::parseIPv6("::1") == loopback);
+    CHECK(Argy::parseIPv6("0:0:0:0:0:0:0:1") == loopback);
+    CHECK(Argy::parseIPv6("::") == IPv6Bytes{});
+    auto mapped = Argy::parseIPv6("::ffff:192.0.2.1");
+    REQUIRE(mapped);
+    CHECK((*mapped)[10] == 0xff);
+    CHECK((*mapped)[12] == 192);
+    CHECK((*mapped)[15] == 1);
+    auto linkLocal = Argy::parseIPv6("fe80::1:2");
+    REQUIRE(linkLocal);
+    CHECK((*linkLocal)[0] == 0xfe);
+    CHECK((*linkLocal)[1] == 0x80);
+    CHECK((*linkLocal)[13] == 1);
+    CHECK((*linkLocal)[15] == 2);
+    CHECK_FALSE(Argy::parseIPv6("1::2::3"));
+    CHECK_FALSE(Argy::parseIPv6("1:2:3:4:5:6:7:8:9"));
+    CHECK_FALSE(Argy::parseIPv6("1:2:3:4:5:6:7:8::"));
+    CHECK_FALSE(Argy::parseIPv6("12345::"));
+    CHECK_FALSE(Argy::parseIPv6(":1"));
+
+    CHECK(Argy::parseMACAddress("00:1A:2B:3C:4D:5E") == MACBytes{0x00, 0x1A, 0x2B, 0x3C, 0x4D, 0x5E});
+    CHECK_FALSE(Argy::parseMACAddress("00:1A:2B:3C:4D:5G"));
+
+    auto uuid = Argy::parseUUID("123e4567-e89b-12d3-a456-426614174000");
+    REQUIRE(uuid);
+    CHECK((*uuid)[0] == 0x12);
+    CHECK((*uuid)[6] == 0x12);
+    CHECK((*uuid)[15] == 0x00);
+    CHECK_FALSE(Argy::parseUUID("123e4567e89b-12d3-a456-426614174000-"));
+    CHECK_FALSE(Argy::parseUUID("123e4567-e89b-12d3-a456-42661417400g"));
+
+    CHECK(Argy::detail::isEmail("first.last+tag@mail.example.org"));
+    CHECK_FALSE(Argy::detail::isEmail("user@localhost"));
+    CHECK_FALSE(Argy::detail::isEmail("a@b@example.com"));
+    CHECK(Argy::detail::isUrl("http://example.com:8080/path?q=1"));
+    CHECK_FALSE(Argy::detail::isUrl("ftp://example.com"));
+    CHECK_FALSE(Argy::detail::isUrl("https://localhost/"));
+}
+
+TEST_CASE("Validation: IsIPv6 accepts compressed forms") {
+    CliParser parser(0, nullptr);
+    parser.addString("--ip", "IPv6 address").isIPv6();
+    CHECK(parser.parse({"prog", "--ip", "::1"}).getString("ip") == "::1");
+    CHECK(parser.parse({"prog", "--ip", "2001:db8::8a2e:370:7334"}).getString("ip") == "2001:db8::8a2e:370:7334");
+    CHECK_THROWS_AS(parser.parse({"prog", "--ip", "2001:db8:::1"}), Argy::InvalidValueException);
+}
+
+TEST_CASE("isMatch uses a linear-time automaton for regular patterns") {
+    using Argy::detail::Automaton;
+    auto automaton = Automaton::compile("^[A-Za-z_]\\w*(?:-\\d{1,3})?$");
+    REQUIRE(automaton);
+    CHECK(automaton->deterministic());
+    CHECK(automaton->match("build_42-7"));
+    CHECK_FALSE(automaton->match("42build"));
+    CHECK_FALSE(automaton->match("build-1234"));
+
+    // Constructs outside the regular subset are left to std::regex
+    CHECK_FALSE(Automaton::compile("(a)\\1"));
+    CHECK_FALSE(Automaton::compile("a(?=b)"));
+    CHECK_FALSE(Automaton::compile("\\bword"));
+    CHECK_FALSE(Automaton::compile("(a{1000}){1000}"));
+
+    // A DFA too large to build is simulated as an NFA with the same results
+    auto wide = Automaton::compile("(a|b)*a(a|b){12}");
+    REQUIRE(wide);
+    CHECK_FALSE(wide->deterministic());
+    CHECK(wide->match("ba" + std::string(12, 'b')));
+    CHECK_FALSE(wide->match("ab" + std::string(12, 'b')));
+
+    // Nested quantifiers that make std::regex backtrack exponentially, on a long value
+    CliParser parser(0, nullptr);
+    parser.addString("--word", "Word", "ab").isMatch("(a+)+b");
+    parser.addString("--pair", "Pair", "zz").isMatch("(\\w)\\1");
+    std::string longValue(100000, 'a');
+    CHECK_THROWS_AS(parser.parse({"prog", "--word", longValue}), Argy::InvalidValueException);
+    CHECK(parser.parse({"prog", "--word", longValue + "b"}).getString("word").size() == 100001);
+    CHECK(parser.parse({"prog", "--pair", "xx"}).getString("pair") == "xx");
+    CHECK_THROWS_AS(parser.parse({"prog", "--pair", "xy"}), Argy::InvalidValueException);
+}
+
+TEST_CASE("Typed handles read values without lookups or copies") {
+    CliParser parser(0, nullptr);
+    Arg<int> batch = parser.addInt("--batch-size", "Rows per batch", 64).isInRange(1, 4096);
+    Arg<std::vector<std::string>> files = parser.addStrings({"-f", "--files"}, "Input files");
+    Arg<bool> verbose = parser.addBool("--verbose", "Verbose output");
+    Arg<std::string> mode = parser.add<std::string>("--mode", "Mode", std::string("fast")).handle();
+    CHECK(parser[batch] == 64);
+    CHECK_THROWS_AS(parser[files], Argy::MissingArgumentException);
+
+    auto args = parser.parse({"prog", "-f", "a.txt", "b.txt", "--batch-size", "128"});
+    CHECK(args[batch] == 128);
+    CHECK(args.get(files).size() == 2);
+    CHECK(&args[files] == &args[files]);
+    CHECK(args[verbose] == false);
+    CHECK(args[mode] == "fast");
+
+    // Handles stay valid across parses, and the result they read from is independent of the parser
+    auto next = parser.parse({"prog", "-f", "c.txt", "--verbose"});
+    CHECK(next[batch] == 64);
+    CHECK(next[verbose] == true);
+    CHECK(args[files][1] == "b.txt");
+
+    CHECK_THROWS_AS(args[Arg<int>()], Argy::UnknownArgumentException);
+}
+
+TEST_CASE("Schemas and results allocate from a memory resource") {
+    struct CountingResource : std::pmr::memory_resource {
+        size_t allocations = 0;
+        void* do_allocate(size_t bytes, size_t align) override {
+            ++allocations;
+            return std::pmr::new_delete_resource()->allocate(bytes, align);
+        }
+        void do_deallocate(void* p, size_t bytes, size_t align) override {
+            std::pmr::new_delete_resource()->deallocate(p, bytes, align);
+        }
+        bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+    };
+    CountingResource schemaResource, parseResource;
+    {
+        CliParser parser(0, nullptr, false, &schemaResource);
+        parser.addInt({"-n", "--count"}, "Count", 1);
+        parser.addString("name", "Name");
+        CHECK(schemaResource.allocations > 0);
+        CHECK(parser.schema()->resource() == &schemaResource);
+
+        // Copy-on-write copies of the schema stay in its resource
+        auto shared = parser.schema();
+        parser.addBool("--verbose", "Verbose");
+        CHECK(parser.schema() != shared);
+        CHECK(parser.schema()->resource() == &schemaResource);
+
+        ParsedArgs copy;
+        {
+            std::pmr::monotonic_buffer_resource arena(4096, &parseResource);
+            auto args = CliParser::parse(parser.schema(), {"prog", "x", "-n", "7"}, &arena);
+            CHECK(args.getInt("count") == 7);
+            CHECK(parseResource.allocations == 1);
+
+            ParseResult result = CliParser::tryParse(parser.schema(), {"prog", "y"}, &arena);
+            REQUIRE(result.ok());
+            CHECK(result.args.getString("name") == "y");
+            CHECK(parseResource.allocations == 1);
+
+            // Move assignment takes the values with their resource instead of copying them out
+            static_assert(std::is_nothrow_move_assignable_v<ParsedArgs>, "results move without copying");
+            CountingResource heap;
+            std::pmr::memory_resource* previous = std::pmr::set_default_resource(&heap);
+            ParsedArgs moved;
+            moved = std::move(args);
+            std::pmr::set_default_resource(previous);
+            CHECK(heap.allocations == 0);
+            CHECK(moved.getInt("count") == 7);
+
+            // A copy leaves the arena, so it may outlive it
+            copy = moved;
+        }
+        CHECK(copy.getInt("count") == 7);
+    }
+}
+
+TEST_CASE("ParseBuffer string lists outlive a temporary token vector") {
+    CliParser parser(0, nullptr);
+    Arg<std::vector<std::string>> files = parser.addStrings({"-f", "--files"}, "Files", Strings{"d"});
+    Arg<std::string> mode = parser.addString("--mode", "Mode", "fast");
+    ParseBuffer buffer(parser.schema());
+
+    // The braced vector is gone after parse(); only the literals it pointed at remain
+    buffer.parse({"prog", "-f", "a.txt", "b.txt", "--mode", "slow"});
+    REQUIRE(buffer[files].size() == 2);
+    CHECK(buffer[files][0] == "a.txt");
+    CHECK(buffer[files][1] == "b.txt");
+    CHECK(buffer[mode] == "slow");
+
+    buffer.parse({"prog"});
+    REQUIRE(buffer[files].size() == 1);
+    CHECK(buffer[files][0] == "d");
+}
+
+TEST_CASE("ParseBuffer reports the same errors as the parser") {
+    CliParser parser(0, nullptr);
+    Arg<int> batch = parser.addInt("--batch-size", "Rows per batch", 64).isInRange(1, 4096);
+    Arg<std::vector<int>> ids = parser.addInts("--ids", "Ids", Ints{4, 5});
+    Arg<std::string> name = parser.addString("name", "Name");
+    ParseBuffer buffer(parser.schema());
+
+    ParseError error = buffer.tryParse({"prog", "--batch-size", "0", "n"});
+    CHECK(error.code == ParseErrorCode::ValidationFailed);
+    CHECK(error.message() == CliParser::tryParse(parser.schema(), {"prog", "--batch-size", "0", "n"}).error.message());
+    CHECK_THROWS_AS(buffer.get(batch), Argy::MissingArgumentException);
+    CHECK_THROWS_AS(buffer.parse({"prog", "n", "--ids", "1", "x"}), Argy::InvalidValueException);
+    CHECK(buffer.tryParse({"prog"}).code == ParseErrorCode::MissingArgument);
+    CHECK(buffer.tryParse({"prog", "--nope"}).code == ParseErrorCode::UnknownArgument);
+
+    CHECK(!buffer.tryParse({"prog", "--help"}));
+    CHECK(buffer.helpRequested());
+
+    buffer.parse({"prog", "n"});
+    CHECK(!buffer.helpRequested());
+    CHECK(buffer[batch] == 64);
+    CHECK(buffer[ids].size() == 2);
+    CHECK(buffer[ids][1] == 5);
+    CHECK(buffer[name] == "n");
+    CHECK_THROWS_AS(buffer.get(Arg<int>()), Argy::UnknownArgumentException);
+    CHECK_THROWS_AS(buffer.get(Arg<std::vector<int>>(name.id())), Argy::UnknownArgumentException);
+
+    // Nothing from a failed parse is readable, including values converted before the error
+    CHECK(buffer.tryParse({"prog", "--batch-size", "7"}).code == ParseErrorCode::MissingArgument);
+    CHECK_THROWS_AS(buffer.get(batch), Argy::MissingArgumentException);
+    CHECK_THROWS_AS(buffer.get(ids), Argy::MissingArgumentException);
+    CHECK(buffer.tryParse({"prog", "m", "--ids", "1", "x"}).code == ParseErrorCode::InvalidValue);
+    CHECK_THROWS_AS(buffer.get(name), Argy::MissingArgumentException);
+    CHECK_THROWS_AS(buffer.get(batch), Argy::MissingArgumentException);
+}
+
+TEST_CASE("Bind options into variables and struct members") {
+    struct Options {
+        int threads = 1;
+        std::vector<float> weights;
+        std::string mode;
+        bool dryRun = false;
+    };
+
+    SUBCASE("Variables bound by pointer take their current value as default") {
+        int threads = 4;
+        std::vector<std::string> files;
+        CliParser parser(0, nullptr);
+        parser.add({"-t", "--threads"}, "Worker threads", &threads).isInRange(1, 64);
+        parser.add("--files", "Input files", &files);
+        parser.addString("--name", "Name", "anon");
+
+        auto args = parser.parse({"prog", "--files", "a", "b", "--name", "x"});
+        CHECK(threads == 4);
+        CHECK(files == std::vector<std::string>{"a", "b"});
+        CHECK(args.getString("name") == "x");
+
+        auto bound = parser.parse({"prog", "-t", "16", "--files", "c"});
+        CHECK(threads == 16);
+        CHECK(files == std::vector<std::string>{"c"});
+        // Bound values stay readable in the result
+        CHECK(bound.has("threads"));
+        CHECK(bound.getInt("threads") == 16);
+        CHECK(bound.getStrings("files") == std::vector<std::string>{"c"});
+
+        // A failed validation leaves the variables untouched
+        CHECK_THROWS_AS(parser.parse({"prog", "-t", "99", "--files", "d"}), Argy::OutOfRangeException);
+        CHECK(threads == 16);
+        CHECK(files == std::vector<std::string>{"c"});
+    }
+
+    SUBCASE("Members are filled per parse, with defaults and validators") {
+        CliParser parser(0, nullptr);
+        parser.add({"-t", "--threads"}, "Worker threads", &Options::threads, 2).isInRange(1, 64);
+        parser.add({"-w", "--weights"}, "Weights", &Options::weights);
+        parser.add("--mode", "Mode", &Options::mode, std::string("fast")).isOneOf({"fast", "exact"});
+        parser.add("--dry-run", "Do nothing", &Options::dryRun);
+
+        Options first;
+        auto args = parser.parseInto({"prog", "-w", "0.5", "1.5"}, first);
+        CHECK(first.threads == 2);
+        CHECK(first.weights == std::vector<float>{0.5f, 1.5f});
+        CHECK(first.mode == "fast");
+        CHECK(first.dryRun == false);
+        CHECK(args.getFloats("weights") == std::vector<float>{0.5f, 1.5f});
+        CHECK(args.has("weights"));
+        CHECK(args.getInt("threads") == 2);
+
+        Options second;
+        parser.parseInto({"prog", "-t", "8", "-w", "2", "--mode", "exact", "--dry-run"}, second);
+        CHECK(second.threads == 8);
+        CHECK(second.mode == "exact");
+        CHECK(second.dryRun == true);
+        CHECK(first.threads == 2);
+
+        Options rejected;
+        CHECK_THROWS_AS(parser.parseInto({"prog", "-w", "1", "--mode", "slow"}, rejected), Argy::InvalidValueException);
+        CHECK(rejected.mode.empty());
+        CHECK_THROWS_AS(parser.parseInto({"prog"}, rejected), Argy::MissingArgumentException);
+
+        // Without a struct, member bindings stay in the result
+        CHECK(parser.parse({"prog", "-w", "3"}).getFloats("weights") == std::vector<float>{3.0f});
+    }
+}
+
+namespace {
+    constexpr auto staticSchema = Argy::Static::makeSchema(
+        Argy::Static::option<std::string_view>("input", "Input file"),
+        Argy::Static::option<int>({"-n", "--count"}, "Number of items", 10),
+        Argy::Static::option<float>({"-r", "--ratio"}, "Ratio", 0.5f),
+        Argy::Static::flag({"-v", "--verbose"}, "Verbose output"),
+        Argy::Static::option<Argy::Static::List<int>>({"-i", "--ids"}, "Ids", {}));
+    static_assert(staticSchema.indexOf("--count") == 1, "indexOf resolves at compile time");
+    static_assert(staticSchema.indexOf("v") == 3, "short names resolve too");
+    static_assert(staticSchema.indexOf("missing") == staticSchema.count, "unknown names map to count");
+}
+
+TEST_CASE("Compile-time schemas parse into a tuple") {
+    using namespace Argy::Static;
+    SUBCASE("Values, defaults and presence") {
+        auto result = staticSchema.parse({"prog", "data.csv", "-n", "-5", "--verbose", "--ids", "1", "2", "3"});
+        CHECK(result.get<0>() == "data.csv");
+        CHECK(result.get<staticSchema.indexOf("count")>() == -5);
+        CHECK(result.get<2>() == doctest::Approx(0.5f));
+        CHECK(result.get<3>() == true);
+        CHECK(result.get<4>() == std::vector<int>{1, 2, 3});
+        CHECK(result.has<1>());
+        CHECK_FALSE(result.has<2>());
+
+        // A repeated list flag starts over, as in CliParser
+        auto repeated = staticSchema.parse({"prog", "--ids", "1", "2", "--ids", "3", "--", "-x"});
+        CHECK(repeated.get<4>() == std::vector<int>{3});
+        CHECK(repeated.get<0>() == "-x");
+    }
+
+    SUBCASE("Help stops parsing before required checks") {
+        auto result = staticSchema.parse({"prog", "--help"});
+        CHECK(result.helpRequested);
+    }
+
+    SUBCASE("Errors match the runtime parser") {
+        CHECK_THROWS_AS(staticSchema.parse({"prog"}), Argy::MissingArgumentException);
+        CHECK_THROWS_AS(staticSchema.parse({"prog", "a", "--nope"}), Argy::UnknownArgumentException);
+        CHECK_THROWS_AS(staticSchema.parse({"prog", "a", "b"}), Argy::UnexpectedPositionalArgumentException);
+        CHECK_THROWS_AS(staticSchema.parse({"prog", "a", "-n", "x"}), Argy::InvalidValueException);
+        CHECK_THROWS_AS(staticSchema.parse({"prog", "a", "-n", "99999999999"}), Argy::OutOfRangeException);
+        CHECK_THROWS_AS(staticSchema.parse({"prog", "a", "--ids", "1", "y"}), Argy::InvalidValueException);
+    }
+
+    SUBCASE("Invalid names throw when the schema is built at run time") {
+        CHECK_THROWS_AS(makeSchema(option<int>("--a", "", 1), option<int>({"-a"}, "", 2)), Argy::DuplicateArgumentException);
+        CHECK_THROWS_AS(makeSchema(flag({"-h"}, "")), Argy::ReservedArgumentException);
+        CHECK_THROWS_AS(makeSchema(option<int>({"-a", "-b"}, "", 1)), Argy::InvalidArgumentException);
+    }
+
+    SUBCASE("Perfect hash finds every name of a larger schema") {
+        constexpr auto wide = makeSchema(
+            option<int>({"-a", "--alpha"}, "", 1), option<int>({"-b", "--beta"}, "", 2),
+            option<int>({"-c", "--gamma"}, "", 3), option<int>({"-d", "--delta"}, "", 4),
+            option<int>({"-e", "--epsilon"}, "", 5), option<int>({"-z", "--zeta"}, "", 6),
+            option<int>({"-t", "--eta"}, "", 7), option<int>({"-q", "--theta"}, "", 8),
+            option<int>("--iota", "", 9), option<int>("--kappa", "", 10));
+        auto result = wide.parse({"prog", "-a", "10", "--beta", "20", "-c", "30", "--delta", "40", "-e", "50",
+                                  "--zeta", "60", "-t", "70", "--theta", "80", "--iota", "90", "--kappa", "100"});
+        CHECK(result.get<0>() + result.get<1>() + result.get<2>() + result.get<3>() + result.get<4>() == 150);
+        CHECK(result.get<5>() + result.get<6>() + result.get<7>() + result.get<8>() + result.get<9>() == 400);
+        CHECK_THROWS_AS(wide.parse({"prog", "--a"}), Argy::UnknownArgumentException);
+        CHECK_THROWS_AS(wide.parse({"prog", "-alpha"}), Argy::UnknownArgumentException);
+    }
+}
+
+TEST_CASE("Arguments are kept and listed in declaration order") {
+    CliParser parser(0, nullptr, false);
+    parser.addString("--zeta", "Last letter", "z");
+    parser.addInt({"-a", "--alpha"}, "First letter", 1);
+    parser.addString("target", "Target");
+    parser.addBool("--mid", "Middle");
+    parser.addInts("--beta", "Second letter").validate([](const std::string&, const Ints&) {});
+
+    auto schema = parser.schema();
+    REQUIRE(schema->arguments.size() == 5);
+    CHECK(schema->arguments[0].names[0] == "zeta");
+    CHECK(schema->arguments[1].longForms[0] == "alpha");
+    for (size_t id = 0; id < schema->arguments.size(); ++id) {
+        const auto& record = schema->records[id];
+        const auto& argument = schema->arguments[id];
+        CHECK(argument.id == id);
+        CHECK(record.type == argument.type);
+        CHECK(record.required == argument.required);
+        CHECK(record.positional == argument.positional);
+        CHECK(record.validated == static_cast<bool>(argument.validator));
+    }
+    CHECK(schema->findId("alpha") == 1);
+    CHECK(schema->findId("--beta") == 4);
+    CHECK(schema->findId("gamma") == CliData::Schema::npos);
+
+    std::ostringstream help;
+    std::streambuf* old = std::cout.rdbuf(help.rdbuf());
+    parser.printHelp("prog");
+    std::cout.rdbuf(old);
+    std::string text = help.str();
+    size_t zeta = text.find("--zeta"), alpha = text.find("--alpha"), mid = text.find("--mid"), beta = text.find("--beta");
+    REQUIRE(beta != std::string::npos);
+    CHECK(zeta < alpha);
+    CHECK(alpha < mid);
+    CHECK(mid < beta);
+
+    // The first missing required argument in declaration order is reported
+    ParseResult result = CliParser::tryParse(schema, {"prog"});
+    CHECK(result.error.code == ParseErrorCode::MissingArgument);
+    CHECK(result.error.argId == 2);
+}
+
+TEST_CASE("Help is rendered once and reused until the parser changes") {
+    CliParser parser(0, nullptr, false);
+    parser.addString("input", "Input file");
+    parser.addInt({"-c", "--count", "--cnt"}, "Count", 3);
+
+    std::ostringstream first;
+    parser.printHelp(first, "prog");
+    const std::string& cached = parser.helpText("prog");
+    CHECK(first.str() == cached);
+    CHECK(&parser.helpText("prog") == &cached);
+    CHECK(cached.find("Usage: prog <input> [options]") != std::string::npos);
+    CHECK(cached.find("alias: [--cnt]") != std::string::npos);
+
+    // Adding an argument or changing help settings renders again
+    parser.addBool("--verbose", "Verbose output");
+    CHECK(parser.helpText("prog").find("--verbose") != std::string::npos);
+    parser.setHelpFooter("See the manual");
+    CHECK(parser.helpText("prog").find("See the manual") != std::string::npos);
+    CHECK(parser.helpText("other").find("Usage: other") != std::string::npos);
+
+#ifndef _WIN32
+    std::FILE* file = std::tmpfile();
+    REQUIRE(file != nullptr);
+    CHECK(parser.printHelp(fileno(file), "prog"));
+    std::rewind(file);
+    std::string written;
+    char chunk[256];
+    for (size_t n; (n = std::fread(chunk, 1, sizeof(chunk), file)) > 0;) written.append(chunk, n);
+    std::fclose(file);
+    CHECK(written == parser.helpText("prog"));
+#endif
+}
+
+TEST_CASE("Help search lists only matching arguments") {
+    CliParser parser(0, nullptr, false);
+    parser.addString("input", "Input image");
+    parser.addBool({"-c", "--color"}, "Colorize output");
+    parser.addInt({"-w", "--width", "--columns"}, "Output width in columns", 80);
+    parser.addString("--cache-dir", "Where thumbnails are kept", "/tmp");
+
+    CHECK(parser.searchHelp("color") == std::vector<size_t>{1});
+    CHECK(parser.searchHelp("COLUMN") == std::vector<size_t>{2});
+    CHECK(parser.searchHelp("output") == std::vector<size_t>{1, 2});
+    CHECK(parser.searchHelp("output width") == std::vector<size_t>{2});
+    CHECK(parser.searchHelp("cache") == std::vector<size_t>{3});
+    CHECK(parser.searchHelp("image") == std::vector<size_t>{0});
+    CHECK(parser.searchHelp("--cache-dir") == std::vector<size_t>{3});
+    CHECK(parser.searchHelp("missing").empty());
+    CHECK(parser.searchHelp("  ").empty());
+
+    // The index is rebuilt after the schema changes
+    parser.addBool("--colour", "British spelling");
+    CHECK(parser.searchHelp("colo") == std::vector<size_t>{1, 4});
+
+    std::ostringstream found;
+    parser.printHelp(found, "prog", "width");
+    CHECK(found.str().find("--width") != std::string::npos);
+    CHECK(found.str().find("alias: [--columns]") != std::string::npos);
+    CHECK(found.str().find("--color") == std::string::npos);
+    CHECK(found.str().find("input") == std::string::npos);
+
+    std::ostringstream none;
+    parser.printHelp(none, "prog", "zebra");
+    CHECK(none.str().find("No arguments match \"zebra\"") != std::string::npos);
+
+    CHECK(CliParser::helpQuery({"prog", "--help", "color"}) == "color");
+    CHECK(CliParser::helpQuery({"prog", "-h", "--color"}).empty());
+    CHECK(CliParser::helpQuery({"prog", "--help"}).empty());
+    CHECK(CliParser::helpQuery({"prog", "--", "--help", "color"}).empty());
+
+    bool called = false;
+    parser.setHelpHandler([&](std::string) { called = true; });
+    ParsedArgs result = parser.parse({"prog", "--help", "color"});
+    CHECK(called);
+    CHECK(result.helpRequested());
+}
+
+TEST_CASE("Streamed help writes bounded chunks with fixed columns") {
+    // Records the size of every write it receives
+    struct ChunkBuffer : std::streambuf {
+        std::string text;
+        std::vector<size_t> writes;
+        int overflow(int c) override { text += static_cast<char>(c); writes.push_back(1); return c; }
+        std::streamsize xsputn(const char* s, std::streamsize n) override {
+            text.append(s, static_cast<size_t>(n));
+            writes.push_back(static_cast<size_t>(n));
+            return n;
+        }
+    };
+
+    CliParser parser(0, nullptr, false);
+    parser.setHelpHeader("Generated tool");
+    parser.addString("input", "Input file");
+    parser.addInt({"-c", "--count", "--cnt"}, "Count", 3);
+    parser.addBool("--a-very-long-option-name-that-overflows", "Long");
+    for (int i = 0; i < 2000; ++i) parser.addInt({"--option-" + std::to_string(i)}, "Generated option", 0);
+
+    ChunkBuffer buffer;
+    std::ostream os(&buffer);
+    parser.streamHelp(os, "prog");
+    // The header and usage are written before any option is rendered
+    REQUIRE(buffer.writes.size() > 10);
+    CHECK(buffer.text.compare(0, buffer.writes[0], "Generated tool\n\nUsage: prog <input> [options]\n\n") == 0);
+    for (size_t size : buffer.writes) CHECK(size < 4096 + 256);
+
+    const std::string& text = buffer.text;
+    CHECK(text.find("  input                     Input file\n") != std::string::npos);
+    CHECK(text.find("  -c, --count              <int>       Count (default: 3)\n  alias: [--cnt] \n") != std::string::npos);
+    CHECK(text.find("      --a-very-long-option-name-that-overflows             Long (default: false)\n") != std::string::npos);
+    CHECK(text.find("      --option-1999        <int>       Generated option (default: 0)\n") != std::string::npos);
+    CHECK(text.find("  -h, --help                           Show this help message\n") != std::string::npos);
+}
+
+TEST_CASE("Lazy arguments are converted and validated on first read") {
+    CliParser parser(0, nullptr);
+    Arg<Ints> ids = parser.addInts("--ids", "Sample ids", Ints{}).lazy();
+    Arg<int> level = parser.addInt("--level", "Level", 1).isInRange(1, 5).lazy();
+    Arg<Floats> weights = parser.addFloats("--weights", "Weights", Floats{0.5f}).lazy();
+    parser.addInt("--count", "Count", 0);
+    auto schema = parser.schema();
+
+    SUBCASE("Values are converted once and kept") {
+        std::vector<std::string> storage = {"prog", "--ids", "1", "2", "3", "--level", "4"};
+        std::vector<std::string_view> tokens(storage.begin(), storage.end());
+        ParsedArgs args = CliParser::parse(schema, tokens);
+        // Tokens were copied, so the caller's storage may go away
+        storage.assign(storage.size(), "xxxxxxxx");
+        CHECK(args.has("ids"));
+        CHECK(args.has("level"));
+        const Ints& first = args.get(ids);
+        CHECK(first == Ints{1, 2, 3});
+        CHECK(&args.get(ids) == &first);
+        CHECK(args.getInts("ids") == Ints{1, 2, 3});
+        CHECK(args.get(level) == 4);
+        CHECK(args.get(weights) == Floats{0.5f});
+        // Copies share the converted values
+        ParsedArgs copy = args;
+        CHECK(&copy.get(ids) == &first);
+    }
+
+    SUBCASE("Bad values are reported by the first read, not by parse") {
+        ParsedArgs args = CliParser::parse(schema, {"prog", "--ids", "1", "x", "--level", "9", "--count", "2"});
+        CHECK(args.getInt("count") == 2);
+        CHECK_THROWS_AS(args.get(ids), Argy::InvalidValueException);
+        CHECK_THROWS_AS(args.getInts("ids"), Argy::InvalidValueException);
+        CHECK_THROWS_AS(args.get(level), Argy::OutOfRangeException);
+
+        ParseResult result = CliParser::tryParse(schema, {"prog", "--level", "9"});
+        CHECK(result.ok());
+        CHECK_THROWS_AS(result.args.get(level), Argy::OutOfRangeException);
+    }
+
+    SUBCASE("Eager arguments still fail in parse") {
+        CHECK_THROWS_AS(CliParser::parse(schema, {"prog", "--count", "two"}), Argy::InvalidValueException);
+    }
+
+    SUBCASE("Parser instances keep lazy values too") {
+        ParsedArgs args = parser.parse({"prog", "--level", "2"});
+        CHECK(args.get(level) == 2);
+        CHECK(parser.get(level) == 2);
+        CHECK(args.get(ids).empty());
+    }
+}
+
+TEST_CASE("Computed defaults run only when the argument is absent and read") {
+    CliParser parser(0, nullptr, false);
+    int probes = 0;
+    Arg<int> jobs = parser.addInt({"-j", "--jobs"}, "Parallel jobs")
+        .defaultTo("number of CPUs", [&] { ++probes; return 8; });
+    Arg<std::string> out = parser.addString("--out", "Output directory", "build");
+    Arg<std::string> log = parser.addString("--log", "Log file")
+        .defaultTo("<out>/log.txt", [](const CliReader& args) { return args.getString("out") + "/log.txt"; });
+    Arg<int> batch = parser.addInt("--batch", "Batch size")
+        .isInRange(1, 64)
+        .defaultTo("twice --jobs", [jobs](const CliReader& args) { return 2 * args.get(jobs); });
+    auto schema = parser.schema();
+
+    SUBCASE("Absent values are computed once, on first read") {
+        ParsedArgs args = CliParser::parse(schema, {"prog", "--out", "dist"});
+        CHECK(probes == 0);
+        CHECK(args.has("jobs"));
+        CHECK(probes == 0);
+        CHECK(args.get(jobs) == 8);
+        CHECK(args.getInt("jobs") == 8);
+        CHECK(probes == 1);
+        CHECK(args.get(log) == "dist/log.txt");
+        CHECK(args.get(batch) == 16);
+        CHECK(probes == 1);
+        CHECK(args.get(out) == "dist");
+    }
+
+    SUBCASE("Given values are never computed") {
+        ParsedArgs args = parser.parse({"prog", "-j", "3", "--log", "x.log"});
+        CHECK(args.get(jobs) == 3);
+        CHECK(args.get(log) == "x.log");
+        CHECK(args.get(batch) == 6);
+        CHECK(probes == 0);
+    }
+
+    SUBCASE("Computed values are validated") {
+        ParseResult result = CliParser::tryParse(schema, {"prog", "-j", "40"});
+        REQUIRE(result.ok());
+        CHECK_THROWS_AS(result.args.get(batch), Argy::OutOfRangeException);
+    }
+
+    SUBCASE("Help shows the description without computing") {
+        std::string text = parser.helpText("prog");
+        CHECK(text.find("Parallel jobs (default: number of CPUs)") != std::string::npos);
+        CHECK(text.find("(default: <out>/log.txt)") != std::string::npos);
+        CHECK(text.find("--jobs") != std::string::npos);
+        CHECK(probes == 0);
+    }
+}
+
+TEST_CASE("Computed defaults that read each other in a cycle are reported") {
+    CliParser parser(0, nullptr);
+    Arg<int> width = parser.addInt("--width", "Width")
+        .defaultTo("from height", [](const CliReader& args) { return args.getInt("height"); });
+    Arg<int> height = parser.addInt("--height", "Height")
+        .defaultTo("from width", [](const CliReader& args) { return args.getInt("width"); });
+
+    ParsedArgs args = parser.parse({"prog"});
+    CHECK_THROWS_AS(args.get(width), Argy::InvalidArgumentException);
+    CHECK_THROWS_AS(args.get(height), Argy::InvalidArgumentException);
+    ParsedArgs given = parser.parse({"prog", "--height", "5"});
+    CHECK(given.get(width) == 5);
+
+    int bound = 0;
+    CHECK_THROWS_AS(parser.add({"--bound"}, "Bound", &bound).defaultTo("never", [] { return 1; }),
+                    Argy::InvalidArgumentException);
+}
@@ -0,0 +1,191 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "argy.hpp"
+#include <doctest.h>
+#include <atomic>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace Argy;
+
+// Builds the shared schema used by every worker
+static std::shared_ptr<const CliParser::Schema> makeSchema() {
+    CliParser parser(0, nullptr);
+    parser.addString("input", "Input file");
+    parser.addInt({"-t", "--threads"}, "Worker threads", 1).isInRange(1, 1024);
+    parser.addFloat({"-r", "--rate"}, "Sampling rate", 1.0f);
+    parser.addBool({"-v", "--verbose"}, "Verbose output");
+    parser.addInts({"-i", "--ids"}, "Sample ids", Ints{});
+    parser.addString({"-m", "--mode"}, "Mode", "fast").isOneOf({"fast", "slow"});
+    return parser.schema();
+}
+
+// One command line whose values are derived from (worker, iteration) so results can be checked
+struct Command {
+    std::vector<std::string> storage;
+    std::vector<std::string_view> tokens;
+
+    Command(int worker, int iteration) {
+        storage = {"prog", "file" + std::to_string(worker) + ".txt", "--threads", std::to_string(1 + iteration % 64),
+                   "--ids", std::to_string(worker), std::to_string(iteration), "-m", iteration % 2 ? "slow" : "fast"};
+        if (iteration % 3 == 0) storage.push_back("-v");
+        for (const auto& s : storage) tokens.emplace_back(s);
+    }
+};
+
+// Parses `perThread` commands on each of `threadCount` threads; returns mismatches found
+static int runWorkers(const std::shared_ptr<const CliParser::Schema>& schema, int threadCount, int perThread) {
+    std::atomic<int> mismatches{ 0 };
+    std::vector<std::thread> workers;
+    for (int w = 0; w < threadCount; ++w) {
+        workers.emplace_back([&, w] {
+            for (int it = 0; it < perThread; ++it) {
+                Command cmd(w, it);
+                auto args = CliParser::parse(schema, cmd.tokens);
+                bool ok = args.getString("input") == "file" + std::to_string(w) + ".txt" &&
+                          args.getInt("threads") == 1 + it % 64 &&
+                          args.getBool("verbose") == (it % 3 == 0) &&
+                          args.getInts("ids") == Ints{w, it} &&
+                          args.getString("mode") == (it % 2 ? "slow" : "fast") &&
+                          args.getFloat("rate") == 1.0f;
+                if (!ok) ++mismatches;
+            }
+        });
+    }
+    for (auto& t : workers) t.join();
+    return mismatches.load();
+}
+
+TEST_CASE("Concurrent parses against a shared schema produce independent results") {
+    auto schema = makeSchema();
+    unsigned cores = std::max(2u, std::thread::hardware_concurrency());
+    CHECK(runWorkers(schema, static_cast<int>(cores * 2), 2000) == 0);
+}
+
+TEST_CASE("Concurrent parse errors stay in their own thread") {
+    auto schema = makeSchema();
+    std::atomic<int> thrown{ 0 };
+    std::vector<std::thread> workers;
+    for (int w = 0; w < 4; ++w) {
+        workers.emplace_back([&] {
+            for (int it = 0; it < 500; ++it) {
+                std::vector<std::string_view> bad = {"prog", "in.txt", "--threads", "0"};
+                try {
+                    CliParser::parse(schema, bad);
+                } catch (const OutOfRangeException&) {
+                    ++thrown;
+                }
+                auto good = CliParser::parse(schema, {"prog", "in.txt", "--threads", "8"});
+                if (good.getInt("threads") != 8) thrown += 100000;
+            }
+        });
+    }
+    for (auto& t : workers) t.join();
+    CHECK(thrown.load() == 4 * 500);
+}
+
+TEST_CASE("Help on the shared-schema path is reported, not printed") {
+    auto schema = makeSchema();
+    auto args = CliParser::parse(schema, {"prog", "--help"});
+    CHECK(args.helpRequested());
+}
+
+TEST_CASE("parseBatch returns results and errors in input order") {
+    auto schema = makeSchema();
+    std::vector<std::string> lines;
+    for (int i = 0; i < 5000; ++i) {
+        if (i % 7 == 3)
+            lines.push_back("prog in.txt --threads 0");          // out of range
+        else if (i % 7 == 5)
+            lines.push_back("prog in.txt --bogus");              // unknown argument
+        else
+            lines.push_back("prog 'job " + std::to_string(i) + ".txt' -t " + std::to_string(1 + i % 100) + " --ids " + std::to_string(i));
+    }
+    auto results = CliParser::parseBatch(schema, lines, 4);
+    REQUIRE(results.size() == lines.size());
+    int wrong = 0;
+    for (int i = 0; i < 5000; ++i) {
+        const auto& r = results[i];
+        if (i % 7 == 3) {
+            wrong += r.ok() || r.message().find("out of range") == std::string::npos;
+        } else if (i % 7 == 5) {
+            wrong += r.ok() || r.message().find("--bogus") == std::string::npos;
+        } else {
+            wrong += !r.ok() || r.args.getString("input") != "job " + std::to_string(i) + ".txt" ||
+                     r.args.getInt("threads") != 1 + i % 100 || r.args.getInts("ids") != Ints{i};
+        }
+    }
+    CHECK(wrong == 0);
+}
+
+TEST_CASE("parseBatch accepts pre-tokenized command lines") {
+    auto schema = makeSchema();
+    std::vector<std::vector<std::string_view>> commands = {
+        {"prog", "a.txt", "-v"},
+        {"prog"},
+        {"prog", "b.txt", "--mode", "slow"},
+    };
+    auto results = CliParser::parseBatch(schema, commands);
+    REQUIRE(results.size() == 3);
+    CHECK(results[0].ok());
+    CHECK(results[0].args.getBool("verbose"));
+    CHECK(!results[1].ok());
+    CHECK(results[1].error.code == ParseErrorCode::MissingArgument);
+    CHECK_THROWS_AS(results[1].error.raise(), MissingArgumentException);
+    CHECK(results[2].args.getString("mode") == "slow");
+}
+
+TEST_CASE("splitCommandLine handles whitespace and quotes") {
+    auto tokens = CliParser::splitCommandLine("  prog\t\"two words\"  'x' last ");
+    CHECK(tokens == std::vector<std::string_view>{"prog", "two words", "x", "last"});
+    CHECK(CliParser::splitCommandLine("   ").empty());
+}
+
+TEST_CASE("Concurrent first reads of a lazy argument convert it once") {
+    CliParser parser(0, nullptr);
+    std::atomic<int> validations{ 0 };
+    Arg<Ints> ids = parser.addInts("--ids", "Sample ids", Ints{})
+        .validate([&](const std::string&, const Ints&) { ++validations; })
+        .lazy();
+    std::vector<std::string> storage = {"prog", "--ids"};
+    for (int i = 0; i < 10000; ++i) storage.push_back(std::to_string(i));
+    std::vector<std::string_view> tokens(storage.begin(), storage.end());
+    ParsedArgs args = CliParser::parse(parser.schema(), tokens);
+
+    std::atomic<int> mismatches{ 0 };
+    std::vector<std::thread> readers;
+    for (int t = 0; t < 8; ++t) {
+        readers.emplace_back([&] {
+            const Ints& values = args.get(ids);
+            if (values.size() != 10000 || values[9999] != 9999) ++mismatches;
+        });
+    }
+    for (auto& t : readers) t.join();
+    CHECK(mismatches.load() == 0);
+    CHECK(validations.load() == 1);
+}
+
+TEST_CASE("Concurrent help rendering and search on one parser") {
+    CliParser parser(0, nullptr, false);
+    for (int i = 0; i < 200; ++i)
+        parser.addInt({"--option-" + std::to_string(i)}, "Option number " + std::to_string(i), i);
+    const std::string expected = CliParser(parser).helpText("prog");
+
+    std::atomic<int> mismatches{ 0 };
+    std::vector<std::thread> readers;
+    for (int t = 0; t < 8; ++t) {
+        readers.emplace_back([&, t] {
+            for (int round = 0; round < 50; ++round) {
+                // Half the threads alternate program names, so the cached text keeps being replaced
+                std::string program = t % 2 && round % 2 ? "other" : "prog";
+                std::ostringstream os;
+                parser.printHelp(os, program);
+                if (program == "prog" && os.str() != expected) ++mismatches;
+                if (parser.searchHelp("number 199") != std::vector<size_t>{ 199 }) ++mismatches;
+            }
+        });
+    }
+    for (auto& t : readers) t.join();
+    CHECK(mismatches.load() == 0);
+}
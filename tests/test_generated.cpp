@@ -0,0 +1,103 @@
+// Parsers generated by argy-gen must behave like CliParser on the same options
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "argy.hpp"
+#include "generated_schema.hpp"
+#include <doctest.h>
+
+using namespace Argy;
+
+namespace {
+    CliParser runtimeParser() {
+        CliParser cli(0, nullptr);
+        cli.addString("input", "Input file");
+        cli.addString("output", "Output file", "out.txt");
+        cli.addInt({"-n", "--count"}, "Number of items", 10).isInRange(1, 100);
+        cli.addFloat({"-r", "--ratio"}, "Ratio", 0.5f);
+        cli.addBool({"-v", "--verbose"}, "Verbose output");
+        cli.addStrings({"-f", "--files", "--inputs"}, "Extra files", Strings{}).validate([](const std::string& name, const Strings& values) {
+            for (const auto& v : values) IsAlphaNumeric()(name, v);
+        });
+        cli.addInts({"-i", "--ids"}, "Ids");
+        cli.addString("--mode", "Mode", "fast").isOneOf({"fast", "exact"});
+        cli.addString("--user-name", "User name", "a b").isMatch("[a-z ]+");
+        cli.addFloats("--weights", "Weights", Floats{1.0f, 2.5f}).validate(IsVectorInRange(0.0f, 10.0f));
+        cli.addBools("--switches", "Switches", Bools{true, false});
+        return cli;
+    }
+
+    /// Name of the exception a parse throws, or "" if it succeeds
+    template<typename F>
+    std::string outcome(F&& parse) {
+        try {
+            parse();
+        }
+        catch (const UnknownArgumentException&) { return "unknown"; }
+        catch (const UnexpectedPositionalArgumentException&) { return "positional"; }
+        catch (const MissingArgumentException&) { return "missing"; }
+        catch (const OutOfRangeException&) { return "range"; }
+        catch (const InvalidValueException&) { return "invalid"; }
+        return "";
+    }
+}
+
+TEST_CASE("Generated parser matches CliParser") {
+    CliParser cli = runtimeParser();
+    const std::vector<std::vector<std::string_view>> lines = {
+        {"prog", "in", "-i", "1", "2"},
+        {"prog", "in", "o", "-i", "1", "-n", "5", "-r", "-0.25", "-v", "--inputs", "a", "b"},
+        {"prog", "in", "-i", "1", "--ids", "3", "--mode", "exact", "--user-name", "z", "--weights", "0", "10"},
+        {"prog", "-count", "3", "in", "-i", "3", "--switches", "1", "0", "true"},
+        {"prog", "in", "-i", "1", "--", "-x"},
+        {"prog", "in", "-i", "1", "-n"},
+        {"prog", "in"},
+        {"prog", "in", "-i", "x"},
+        {"prog", "in", "-i", "1", "-n", "500"},
+        {"prog", "in", "-i", "1", "-n", "99999999999"},
+        {"prog", "in", "-i", "1", "-r", "fast"},
+        {"prog", "in", "-i", "1", "--mode", "slow"},
+        {"prog", "in", "-i", "1", "-f", "ab", "c d"},
+        {"prog", "in", "-i", "1", "--user-name", "A"},
+        {"prog", "in", "-i", "1", "--weights", "11"},
+        {"prog", "in", "-i", "1", "--nope"},
+        {"prog", "in", "-i", "1", "-q"},
+        {"prog", "in", "out", "extra", "-i", "1"},
+    };
+    for (const auto& line : lines) {
+        std::string expected = outcome([&] { CliParser::parse(cli.schema(), line); });
+        CHECK(outcome([&] { gen::parse(line); }) == expected);
+        if (!expected.empty()) continue;
+
+        ParsedArgs args = CliParser::parse(cli.schema(), line);
+        gen::Options o = gen::parse(line);
+        CHECK(o.input == args.getString("input"));
+        CHECK(o.output == args.getString("output"));
+        CHECK(o.count == args.getInt("count"));
+        CHECK(o.ratio == args.getFloat("ratio"));
+        CHECK(o.verbose == args.getBool("verbose"));
+        CHECK(o.files == args.getStrings("files"));
+        CHECK(o.ids == args.getInts("ids"));
+        CHECK(o.mode == args.getString("mode"));
+        CHECK(o.userName == args.getString("user-name"));
+        CHECK(o.weights == args.getFloats("weights"));
+        CHECK(o.switches == args.getBools("switches"));
+    }
+}
+
+TEST_CASE("Generated parser exposes help and option metadata") {
+    CHECK(gen::parse({"prog", "--help"}).helpRequested);
+    CHECK(gen::parse({"prog", "-i", "1", "-h"}).helpRequested);
+    CHECK(gen::helpText.find("Usage: gen <input> <output> [options]") == 0);
+    CHECK(gen::helpText.find("-n, --count") != std::string_view::npos);
+    CHECK(gen::helpText.find("  alias: [--inputs] \n") != std::string_view::npos);
+    CHECK(gen::types[2] == CliData::ArgType::Int);
+    CHECK(gen::types[10] == CliData::ArgType::BoolList);
+    CHECK(gen::keys[2] == "n");
+
+    // has() reports what appeared on the command line, by any of the option's names
+    gen::Options o = gen::parse({"prog", "in", "--inputs", "-n", "4", "-i"});
+    CHECK(o.has("count"));
+    CHECK(o.has("n"));
+    CHECK(o.has("files"));
+    CHECK_FALSE(o.has("ratio"));
+    CHECK_FALSE(o.has("nope"));
+}
@@ -0,0 +1,27 @@
+// Built with exceptions disabled: errors must be handled through CliParser::tryParse()
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "argy.hpp"
+#include <doctest.h>
+
+using namespace Argy;
+
+TEST_CASE("Argy builds and parses without exceptions") {
+    CliParser parser(0, nullptr);
+    parser.addString("input", "Input file");
+    parser.addInt({"-c", "--count"}, "Count", 1).isInRange(1, 10);
+    parser.addFloats({"-w", "--weights"}, "Weights", Floats{});
+    auto schema = parser.schema();
+
+    auto good = CliParser::tryParse(schema, {"prog", "in.txt", "-c", "4", "-w", "0.5", "-1"});
+    CHECK(good.ok());
+    CHECK(good.args.getInt("count") == 4);
+    CHECK(good.args.getFloats("weights") == Floats{0.5f, -1.0f});
+
+    auto bad = CliParser::tryParse(schema, {"prog", "in.txt", "-c", "four"});
+    CHECK(!bad.ok());
+    CHECK(bad.error.code == ParseErrorCode::InvalidValue);
+    CHECK(bad.message() == "Invalid value for argument 'c': four");
+
+    CHECK(CliParser::tryParse(schema, {"prog"}).error.code == ParseErrorCode::MissingArgument);
+    CHECK(CliParser::tryParse(schema, {"prog", "in.txt", "--nope"}).error.code == ParseErrorCode::UnknownArgument);
+}
@@ -0,0 +1,814 @@
+// argy-gen: compile an option schema file into a specialized parser header
+//
+// Schema files hold one declaration per line; '#' starts a comment.
+//
+//   program <name> ["description"]
+//   <type> <names> [attributes...] ["help text"]
+//
+// <type>  string, int, float, bool (or flag), strings, ints, floats, bools
+// <names> comma-separated, e.g. -n,--count; a name without dashes declares a positional argument
+// Attributes:
+//   default=<value>       optional, with this default; lists take comma-separated values (default= for empty)
+//   range=<min>:<max>     IsValueInRange / IsVectorInRange for int and float types
+//   oneof=<a>|<b>|...     IsOneOf for string types
+//   match=<pattern>       IsMatch for string types
+//   check=<name>          alnum, alpha, numeric, path, file, dir, ipv4, ipv6, ip, mac, email, url or uuid
+// Values may be double-quoted; \" and \\ are escapes inside quotes.
+//
+// The generated header defines, in the chosen namespace, an Options struct with one typed member per
+// option, the help text as a constant, a perfect-hash dispatch table over every name, and parse()
+// functions that behave like Argy::CliParser::parse() and throw the same exceptions.
+#include "argy.hpp"
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace Argy;
+using ArgType = CliData::ArgType;
+
+namespace {
+    /// One declared option, as read from the schema file
+    struct OptionSpec {
+        ArgType type = ArgType::String;
+        std::vector<std::string> shortNames; ///< Without the dash
+        std::vector<std::string> longNames;  ///< Without the dashes; the positional name for positionals
+        bool positional = false;
+        std::string key;                     ///< First declared name without dashes; used in messages
+        std::string member;                  ///< C++ identifier of the Options member, from the first long name
+        std::string help;
+        std::optional<std::vector<std::string>> defaults; ///< Default tokens; empty optional if required
+        std::vector<std::string> validators; ///< C++ expressions creating validator callables
+        int line = 0;
+    };
+
+    struct SchemaSpec {
+        std::string program;
+        std::string description;
+        std::vector<OptionSpec> options;
+    };
+
+    /// A whitespace-separated word of a schema line, with quotes removed
+    struct Word {
+        std::string text;
+        bool quoted = false; ///< True if the word started with a quote
+    };
+
+    class SchemaReader {
+    public:
+        explicit SchemaReader(std::string path) : m_path(std::move(path)) {}
+
+        SchemaSpec read() {
+            std::ifstream in(m_path);
+            if (!in) ARGY_THROW(InvalidArgumentException("Cannot open schema file: " + m_path));
+            SchemaSpec schema;
+            std::string text;
+            while (std::getline(in, text)) {
+                ++m_line;
+                std::vector<Word> words = split(text);
+                if (words.empty()) continue;
+                if (words[0].text == "program" && !words[0].quoted) {
+                    if (words.size() < 2 || words.size() > 3) fail("expected: program <name> [\"description\"]");
+                    schema.program = words[1].text;
+                    if (words.size() == 3) schema.description = words[2].text;
+                    continue;
+                }
+                schema.options.push_back(option(words));
+            }
+            if (schema.options.empty()) fail("the schema declares no options");
+            checkNames(schema);
+            return schema;
+        }
+
+    private:
+        [[noreturn]] void fail(const std::string& message) const {
+            ARGY_THROW(InvalidArgumentException(m_path + ":" + std::to_string(m_line) + ": " + message));
+        }
+
+        std::vector<Word> split(const std::string& text) const {
+            std::vector<Word> words;
+            size_t i = 0;
+            while (i < text.size()) {
+                if (std::isspace(static_cast<unsigned char>(text[i]))) { ++i; continue; }
+                if (text[i] == '#') break;
+                Word word;
+                word.quoted = text[i] == '"';
+                bool inQuotes = false;
+                for (; i < text.size() && (inQuotes || !std::isspace(static_cast<unsigned char>(text[i]))); ++i) {
+                    char c = text[i];
+                    if (c == '"') { inQuotes = !inQuotes; continue; }
+                    if (inQuotes && c == '\\' && i + 1 < text.size()) c = text[++i];
+                    word.text += c;
+                }
+                if (inQuotes) fail("unterminated quote");
+                words.push_back(std::move(word));
+            }
+            return words;
+        }
+
+        static std::optional<ArgType> typeOf(const std::string& name) {
+            if (name == "string") return ArgType::String;
+            if (name == "int") return ArgType::Int;
+            if (name == "float") return ArgType::Float;
+            if (name == "bool" || name == "flag") return ArgType::Bool;
+            if (name == "strings") return ArgType::StringList;
+            if (name == "ints") return ArgType::IntList;
+            if (name == "floats") return ArgType::FloatList;
+            if (name == "bools") return ArgType::BoolList;
+            return std::nullopt;
+        }
+
+        static std::vector<std::string> splitOn(const std::string& text, char separator) {
+            std::vector<std::string> parts;
+            size_t start = 0;
+            for (size_t i = 0; i <= text.size(); ++i) {
+                if (i == text.size() || text[i] == separator) {
+                    parts.push_back(text.substr(start, i - start));
+                    start = i + 1;
+                }
+            }
+            return parts;
+        }
+
+        /// Check that a default or range bound converts like a command-line token would
+        void checkValue(ArgType type, const std::string& token) const {
+            if (type == ArgType::Int || type == ArgType::IntList) {
+                int v = 0;
+                if (CliData::toNumber(token, v) != std::errc()) fail("'" + token + "' is not a valid int");
+            }
+            else if (type == ArgType::Float || type == ArgType::FloatList) {
+                float v = 0;
+                if (CliData::toNumber(token, v) != std::errc() || !std::isfinite(v)) fail("'" + token + "' is not a valid float");
+            }
+            else if ((type == ArgType::Bool || type == ArgType::BoolList) && token != "true" && token != "false" && token != "1" && token != "0") {
+                fail("'" + token + "' is not a valid bool");
+            }
+        }
+
+        OptionSpec option(const std::vector<Word>& words) {
+            OptionSpec spec;
+            spec.line = m_line;
+            if (words[0].quoted || !typeOf(words[0].text)) fail("unknown type '" + words[0].text + "'");
+            spec.type = *typeOf(words[0].text);
+            if (words.size() < 2 || words[1].quoted) fail("expected names after the type");
+
+            for (const std::string& name : splitOn(words[1].text, ',')) {
+                if (name.size() > 2 && name.compare(0, 2, "--") == 0) spec.longNames.push_back(name.substr(2));
+                else if (name.size() > 1 && name[0] == '-' && name[1] != '-') spec.shortNames.push_back(name.substr(1));
+                else if (!name.empty() && name[0] != '-' && words[1].text.find(',') == std::string::npos) {
+                    spec.longNames.push_back(name);
+                    spec.positional = true;
+                }
+                else fail("invalid argument name '" + name + "'");
+                if (spec.key.empty()) spec.key = spec.positional ? name : name.substr(name[1] == '-' ? 2 : 1);
+            }
+            if (spec.positional && CliData::isListType(spec.type)) fail("positional arguments cannot be lists");
+            if (spec.positional && spec.type == ArgType::Bool) fail("positional arguments cannot be flags");
+
+            bool numeric = spec.type == ArgType::Int || spec.type == ArgType::Float ||
+                           spec.type == ArgType::IntList || spec.type == ArgType::FloatList;
+            bool text = spec.type == ArgType::String || spec.type == ArgType::StringList;
+            bool list = CliData::isListType(spec.type);
+            std::string element = spec.type == ArgType::Int || spec.type == ArgType::IntList ? "int" : "float";
+
+            for (size_t i = 2; i < words.size(); ++i) {
+                const Word& word = words[i];
+                size_t eq = word.quoted ? std::string::npos : word.text.find('=');
+                if (eq == std::string::npos) {
+                    if (!word.quoted) fail("unexpected '" + word.text + "'; help text must be quoted");
+                    if (!spec.help.empty()) fail("help text given twice");
+                    spec.help = word.text;
+                    continue;
+                }
+                std::string attribute = word.text.substr(0, eq);
+                std::string value = word.text.substr(eq + 1);
+                if (attribute == "default") {
+                    if (spec.type == ArgType::Bool) fail("flags always default to false");
+                    std::vector<std::string> tokens;
+                    if (!list) tokens.push_back(value);
+                    else if (!value.empty()) tokens = splitOn(value, ',');
+                    for (const std::string& token : tokens) checkValue(spec.type, token);
+                    spec.defaults = tokens;
+                }
+                else if (attribute == "range") {
+                    if (!numeric) fail("range applies to int and float types");
+                    size_t colon = value.find(':');
+                    if (colon == std::string::npos) fail("expected range=<min>:<max>");
+                    std::string low = value.substr(0, colon), high = value.substr(colon + 1);
+                    checkValue(spec.type, low);
+                    checkValue(spec.type, high);
+                    spec.validators.push_back(std::string(list ? "Argy::IsVectorInRange<" : "Argy::IsValueInRange<") + element +
+                                              ">(" + literal(element == "int" ? ArgType::Int : ArgType::Float, low) + ", " +
+                                              literal(element == "int" ? ArgType::Int : ArgType::Float, high) + ")");
+                }
+                else if (attribute == "oneof") {
+                    if (!text) fail("oneof applies to string types");
+                    std::string values;
+                    for (const std::string& v : splitOn(value, '|')) values += (values.empty() ? "" : ", ") + quote(v);
+                    spec.validators.push_back("Argy::IsOneOf({" + values + "})");
+                }
+                else if (attribute == "match") {
+                    if (!text) fail("match applies to string types");
+#ifndef ARGY_NO_EXCEPTIONS
+                    try {
+                        IsMatch(value);
+                    }
+                    catch (const std::regex_error&) {
+                        fail("invalid pattern '" + value + "'");
+                    }
+#endif
+                    spec.validators.push_back("Argy::IsMatch(" + quote(value) + ")");
+                }
+                else if (attribute == "check") {
+                    if (!text) fail("check applies to string types");
+                    static const std::map<std::string, std::string> checks = {
+                        {"alnum", "IsAlphaNumeric"}, {"alpha", "IsAlpha"}, {"numeric", "IsNumeric"},
+                        {"path", "IsPath"}, {"file", "IsFile"}, {"dir", "IsDirectory"},
+                        {"ipv4", "IsIPv4"}, {"ipv6", "IsIPv6"}, {"ip", "IsIPAddress"}, {"mac", "IsMACAddress"},
+                        {"email", "IsEmail"}, {"url", "IsUrl"}, {"uuid", "IsUUID"}};
+                    auto it = checks.find(value);
+                    if (it == checks.end()) fail("unknown check '" + value + "'");
+                    spec.validators.push_back("Argy::" + it->second + "()");
+                }
+                else {
+                    fail("unknown attribute '" + attribute + "'");
+                }
+            }
+            if (spec.type == ArgType::Bool) spec.defaults = std::vector<std::string>{"false"};
+            spec.member = identifier(spec.longNames.empty() ? spec.key : spec.longNames[0]);
+            return spec;
+        }
+
+        /// Reject duplicate, reserved and colliding names, as CliBuilder::add() does
+        void checkNames(const SchemaSpec& schema) {
+            std::map<std::string, int> names;
+            std::map<std::string, int> members;
+            for (const OptionSpec& spec : schema.options) {
+                m_line = spec.line;
+                for (const auto* forms : {&spec.shortNames, &spec.longNames}) {
+                    for (const std::string& name : *forms) {
+                        if (name == "help" && !spec.positional) fail("Cannot redefine built-in --help argument");
+                        if (name == "h" && !spec.positional) fail("Cannot redefine built-in -h argument");
+                        if (!names.emplace(name, spec.line).second) {
+                            ARGY_THROW(DuplicateArgumentException(m_path + ":" + std::to_string(spec.line) +
+                                                                  ": Duplicate argument name: " + name));
+                        }
+                    }
+                }
+                if (spec.member == "helpRequested" || spec.member == "given" || spec.member == "has" ||
+                    !members.emplace(spec.member, spec.line).second) {
+                    fail("option '" + spec.key + "' maps to the member name '" + spec.member + "', which is taken");
+                }
+            }
+        }
+
+        static std::string identifier(const std::string& name) {
+            static const char* const keywords[] = {
+                "alignas", "alignof", "and", "asm", "auto", "bool", "break", "case", "catch", "char", "class",
+                "const", "constexpr", "continue", "default", "delete", "do", "double", "else", "enum", "explicit",
+                "export", "extern", "false", "float", "for", "friend", "goto", "if", "inline", "int", "long",
+                "mutable", "namespace", "new", "noexcept", "not", "nullptr", "operator", "or", "private",
+                "protected", "public", "register", "return", "short", "signed", "sizeof", "static", "struct",
+                "switch", "template", "this", "throw", "true", "try", "typedef", "typename", "union", "unsigned",
+                "using", "virtual", "void", "volatile", "while", "xor"};
+            std::string id;
+            bool upper = false;
+            for (char c : name) {
+                if (std::isalnum(static_cast<unsigned char>(c))) {
+                    id += upper ? static_cast<char>(std::toupper(static_cast<unsigned char>(c))) : c;
+                    upper = false;
+                }
+                else {
+                    upper = !id.empty();
+                }
+            }
+            if (id.empty() || std::isdigit(static_cast<unsigned char>(id[0]))) id = "_" + id;
+            for (const char* keyword : keywords) {
+                if (id == keyword) return id + "_";
+            }
+            return id;
+        }
+
+    public:
+        /// C++ string literal for any text
+        static std::string quote(const std::string& text) {
+            std::string out = "\"";
+            for (char c : text) {
+                switch (c) {
+                case '"': out += "\\\""; break;
+                case '\\': out += "\\\\"; break;
+                case '\n': out += "\\n"; break;
+                case '\t': out += "\\t"; break;
+                default:
+                    if (static_cast<unsigned char>(c) < 0x20) {
+                        char buffer[8];
+                        std::snprintf(buffer, sizeof(buffer), "\\%03o", static_cast<unsigned char>(c));
+                        out += buffer;
+                    }
+                    else {
+                        out += c;
+                    }
+                }
+            }
+            return out + "\"";
+        }
+
+        /// C++ literal for one checked default or bound token of the given element type
+        static std::string literal(ArgType type, const std::string& token) {
+            switch (type) {
+            case ArgType::Int:
+            case ArgType::IntList: {
+                int v = 0;
+                CliData::toNumber(token, v);
+                // INT_MIN has no literal form
+                return v == std::numeric_limits<int>::min() ? "std::numeric_limits<int>::min()" : std::to_string(v);
+            }
+            case ArgType::Float:
+            case ArgType::FloatList: {
+                float v = 0;
+                CliData::toNumber(token, v);
+                char buffer[32];
+                std::snprintf(buffer, sizeof(buffer), "%.9gf", static_cast<double>(v));
+                std::string out = buffer;
+                if (out.find_first_of(".e") == std::string::npos) out.insert(out.size() - 1, ".0");
+                return out;
+            }
+            case ArgType::Bool:
+            case ArgType::BoolList:
+                return token == "true" || token == "1" ? "true" : "false";
+            default:
+                return quote(token);
+            }
+        }
+
+    private:
+        std::string m_path;
+        int m_line = 0;
+    };
+
+    /// Perfect hash over option names: same scheme as Argy::Static::Schema, built at generation time
+    struct NameTable {
+        struct Slot {
+            std::string name;
+            int option = -1;
+        };
+        std::vector<uint32_t> displacement;
+        std::vector<Slot> slots;
+
+        explicit NameTable(const SchemaSpec& schema) {
+            std::vector<Slot> keys;
+            for (size_t i = 0; i < schema.options.size(); ++i) {
+                for (const auto* forms : {&schema.options[i].shortNames, &schema.options[i].longNames}) {
+                    for (const std::string& name : *forms) keys.push_back(Slot{name, static_cast<int>(i)});
+                }
+            }
+            size_t bucketCount = Static::detail::nextPow2(keys.size() / 2 + 1);
+            size_t slotCount = Static::detail::nextPow2(2 * keys.size() + 2);
+            displacement.assign(bucketCount, 0);
+            slots.assign(slotCount, Slot{});
+
+            std::vector<std::vector<size_t>> buckets(bucketCount);
+            std::vector<uint64_t> hashes(keys.size());
+            for (size_t k = 0; k < keys.size(); ++k) {
+                hashes[k] = Static::detail::hashName(keys[k].name, true);
+                buckets[hashes[k] & (bucketCount - 1)].push_back(k);
+            }
+            std::vector<size_t> order(bucketCount);
+            for (size_t b = 0; b < bucketCount; ++b) order[b] = b;
+            // Largest buckets first, while the table is emptiest
+            std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) { return buckets[a].size() > buckets[b].size(); });
+
+            std::vector<size_t> placed;
+            for (size_t bucket : order) {
+                if (buckets[bucket].empty()) break;
+                for (uint32_t d = 0;; ++d) {
+                    if (d == (1u << 24)) ARGY_THROW(InvalidArgumentException("Could not build a perfect hash for the option names"));
+                    placed.clear();
+                    bool fits = true;
+                    for (size_t k : buckets[bucket]) {
+                        size_t slot = Static::detail::mixHash(hashes[k], d) & (slotCount - 1);
+                        if (slots[slot].option >= 0 || std::find(placed.begin(), placed.end(), slot) != placed.end()) {
+                            fits = false;
+                            break;
+                        }
+                        placed.push_back(slot);
+                    }
+                    if (!fits) continue;
+                    for (size_t i = 0; i < placed.size(); ++i) slots[placed[i]] = keys[buckets[bucket][i]];
+                    displacement[bucket] = d;
+                    break;
+                }
+            }
+        }
+    };
+
+    const char* memberType(ArgType type) {
+        switch (type) {
+        case ArgType::String: return "std::string";
+        case ArgType::Int: return "int";
+        case ArgType::Float: return "float";
+        case ArgType::Bool: return "bool";
+        case ArgType::StringList: return "Argy::Strings";
+        case ArgType::IntList: return "Argy::Ints";
+        case ArgType::FloatList: return "Argy::Floats";
+        case ArgType::BoolList: return "Argy::Bools";
+        }
+        return "";
+    }
+
+    const char* typeName(ArgType type) {
+        switch (type) {
+        case ArgType::String: return "String";
+        case ArgType::Int: return "Int";
+        case ArgType::Float: return "Float";
+        case ArgType::Bool: return "Bool";
+        case ArgType::StringList: return "StringList";
+        case ArgType::IntList: return "IntList";
+        case ArgType::FloatList: return "FloatList";
+        case ArgType::BoolList: return "BoolList";
+        }
+        return "";
+    }
+
+    const char* valueLabel(ArgType type) {
+        switch (type) {
+        case ArgType::Int: return "<int>";
+        case ArgType::Float: return "<float>";
+        case ArgType::String: return "<string>";
+        case ArgType::IntList: return "<int[]>";
+        case ArgType::FloatList: return "<float[]>";
+        case ArgType::BoolList: return "<bool[]>";
+        case ArgType::StringList: return "<string[]>";
+        default: return "";
+        }
+    }
+
+    /// Default value as CliParser::printHelp() shows it
+    std::string defaultText(const OptionSpec& spec) {
+        const std::vector<std::string>& tokens = *spec.defaults;
+        auto one = [&](const std::string& token) -> std::string {
+            switch (spec.type) {
+            case ArgType::Int:
+            case ArgType::IntList: { int v = 0; CliData::toNumber(token, v); return std::to_string(v); }
+            case ArgType::Float:
+            case ArgType::FloatList: { float v = 0; CliData::toNumber(token, v); return std::to_string(v); }
+            case ArgType::Bool:
+            case ArgType::BoolList: return token == "true" || token == "1" ? "true" : "false";
+            case ArgType::StringList: return "\"" + token + "\"";
+            default: return token;
+            }
+        };
+        if (!CliData::isListType(spec.type)) return one(tokens[0]);
+        std::string out = "[";
+        for (size_t i = 0; i < tokens.size(); ++i) out += (i ? ", " : "") + one(tokens[i]);
+        return out + "]";
+    }
+
+    /// Plain-text usage in the layout of CliParser::printHelp(), without colors
+    std::string renderHelp(const SchemaSpec& schema) {
+        std::ostringstream os;
+        os << "Usage: " << (schema.program.empty() ? "program" : schema.program);
+        for (const OptionSpec& spec : schema.options)
+            if (spec.positional) os << " <" << spec.longNames[0] << ">";
+        os << " [options]\n\n";
+        if (!schema.description.empty()) os << schema.description << "\n\n";
+
+        size_t posWidth = 0;
+        for (const OptionSpec& spec : schema.options)
+            if (spec.positional) posWidth = std::max(posWidth, spec.longNames[0].size());
+        if (posWidth > 0) {
+            os << "Positional:\n";
+            for (const OptionSpec& spec : schema.options) {
+                if (!spec.positional) continue;
+                os << "  " << spec.longNames[0] << std::string(posWidth - spec.longNames[0].size(), ' ');
+                if (!spec.help.empty()) os << "  " << spec.help;
+                if (spec.defaults) os << " (default: " << defaultText(spec) << ")";
+                os << "\n";
+            }
+            os << "\n";
+        }
+
+        std::vector<std::string> labels;
+        size_t nameWidth = std::string("-h, --help").size();
+        size_t typeWidth = 0;
+        for (const OptionSpec& spec : schema.options) {
+            if (spec.positional) continue;
+            std::string label;
+            if (!spec.shortNames.empty() && !spec.longNames.empty()) label = "-" + spec.shortNames[0] + ", --" + spec.longNames[0];
+            else if (!spec.shortNames.empty()) label = "-" + spec.shortNames[0];
+            else label = "    --" + spec.longNames[0];
+            nameWidth = std::max(nameWidth, label.size());
+            typeWidth = std::max(typeWidth, std::string(valueLabel(spec.type)).size());
+            labels.push_back(label);
+        }
+        os << "Options:\n";
+        size_t index = 0;
+        for (const OptionSpec& spec : schema.options) {
+            if (spec.positional) continue;
+            const std::string& label = labels[index++];
+            std::string type = valueLabel(spec.type);
+            os << "  " << label << std::string(nameWidth - label.size(), ' ');
+            os << " " << type << std::string(typeWidth - type.size(), ' ');
+            if (!spec.help.empty()) os << "  " << spec.help;
+            if (spec.defaults) os << " (default: " << defaultText(spec) << ")";
+            else os << " (required)";
+            os << "\n";
+            std::string aliases;
+            for (size_t i = 1; i < spec.shortNames.size(); ++i) aliases += (aliases.empty() ? "-" : ", -") + spec.shortNames[i];
+            for (size_t i = 1; i < spec.longNames.size(); ++i) aliases += (aliases.empty() ? "--" : ", --") + spec.longNames[i];
+            if (!aliases.empty()) os << "  alias: [" << aliases << "] \n";
+        }
+        os << "  -h, --help" << std::string(nameWidth - 10, ' ') << " " << std::string(typeWidth, ' ')
+           << "  Show this help message\n";
+        return os.str();
+    }
+
+    std::string defaultInitializer(const OptionSpec& spec) {
+        if (!spec.defaults) return "";
+        if (!CliData::isListType(spec.type)) return " = " + SchemaReader::literal(spec.type, (*spec.defaults)[0]);
+        if (spec.defaults->empty()) return "";
+        std::string out = "{ ";
+        for (size_t i = 0; i < spec.defaults->size(); ++i)
+            out += (i ? ", " : "") + SchemaReader::literal(spec.type, (*spec.defaults)[i]);
+        return out + " }";
+    }
+
+    void writeHeader(std::ostream& os, const SchemaSpec& schema, const std::string& ns, const std::string& source) {
+        const std::vector<OptionSpec>& options = schema.options;
+        NameTable table(schema);
+        size_t n = options.size();
+
+        os << "// Generated by argy-gen from " << source << ". Do not edit.\n"
+           << "#pragma once\n"
+           << "#include \"argy.hpp\"\n"
+           << "#include <array>\n"
+           << "#include <cstdint>\n"
+           << "#include <limits>\n"
+           << "#include <string>\n"
+           << "#include <string_view>\n"
+           << "#include <vector>\n\n"
+           << "namespace " << ns << " {\n";
+
+        os << "    /// @brief Parsed values" << (schema.program.empty() ? "" : " of " + schema.program) << ", one member per option.\n"
+           << "    struct Options {\n";
+        for (const OptionSpec& spec : options) {
+            os << "        " << memberType(spec.type) << " " << spec.member << defaultInitializer(spec) << ";";
+            if (!spec.help.empty()) os << " ///< " << spec.help;
+            os << "\n";
+        }
+        os << "        bool helpRequested = false; ///< True if parsing stopped at -h/--help.\n"
+           << "        std::array<bool, " << n << "> given{}; ///< Whether each option appeared, in declaration order.\n\n"
+           << "        /// @brief True if the option with this name (without dashes) appeared on the command line.\n"
+           << "        bool has(std::string_view name) const;\n"
+           << "    };\n\n";
+
+        os << "    /// @brief Usage text, rendered when this header was generated.\n"
+           << "    inline constexpr std::string_view helpText =\n";
+        std::string help = renderHelp(schema);
+        size_t start = 0;
+        while (start < help.size()) {
+            size_t end = help.find('\n', start);
+            end = end == std::string::npos ? help.size() : end + 1;
+            os << "        " << SchemaReader::quote(help.substr(start, end - start)) << (end == help.size() ? ";\n\n" : "\n");
+            start = end;
+        }
+
+        os << "    /// @brief Declared type of each option, in declaration order.\n"
+           << "    inline constexpr Argy::CliData::ArgType types[" << n << "] = {";
+        for (size_t i = 0; i < n; ++i) os << (i % 4 ? " " : "\n        ") << "Argy::CliData::ArgType::" << typeName(options[i].type) << ",";
+        os << "\n    };\n\n"
+           << "    /// @brief Name of each option in messages and validators: its first declared name without dashes.\n"
+           << "    inline constexpr std::string_view keys[" << n << "] = {";
+        for (size_t i = 0; i < n; ++i) os << (i % 6 ? " " : "\n        ") << SchemaReader::quote(options[i].key) << ",";
+        os << "\n    };\n\n";
+
+        os << "    namespace detail {\n"
+           << "        struct Slot {\n"
+           << "            std::string_view name;\n"
+           << "            int option;\n"
+           << "        };\n\n"
+           << "        inline constexpr uint32_t displacement[" << table.displacement.size() << "] = {";
+        for (size_t i = 0; i < table.displacement.size(); ++i)
+            os << (i % 12 ? " " : "\n            ") << table.displacement[i] << ",";
+        os << "\n        };\n\n"
+           << "        inline constexpr Slot slots[" << table.slots.size() << "] = {";
+        for (size_t i = 0; i < table.slots.size(); ++i) {
+            const NameTable::Slot& slot = table.slots[i];
+            os << (i % 4 ? " " : "\n            ") << "{ " << SchemaReader::quote(slot.name) << ", " << slot.option << " },";
+        }
+        os << "\n        };\n\n";
+
+        std::string positionals;
+        size_t positionalCount = 0;
+        for (size_t i = 0; i < n; ++i) {
+            if (!options[i].positional) continue;
+            positionals += (positionals.empty() ? "" : ", ") + std::to_string(i);
+            ++positionalCount;
+        }
+        os << "        inline constexpr std::array<int, " << positionalCount << "> positionals = { " << positionals << " };\n\n";
+
+        os << R"(        /// Option index for a name without dashes, or -1; dash count is not checked, as in CliParser
+        inline int find(std::string_view name) {
+            uint64_t h = Argy::Static::detail::hashName(name, true);
+            const Slot& slot = slots[Argy::Static::detail::mixHash(h, displacement[h & )" << (table.displacement.size() - 1)
+           << "]) & " << (table.slots.size() - 1) << R"(];
+            return (slot.option >= 0 && slot.name == name) ? slot.option : -1;
+        }
+
+        inline std::string key(int option) { return std::string(keys[option]); }
+
+        template<typename T>
+        void convert(int option, std::string_view token, T& out) {
+            bool list = Argy::CliData::isListType(types[option]);
+            if constexpr (std::is_same_v<T, std::string>) {
+                out.assign(token.data(), token.size());
+            }
+            else if constexpr (std::is_same_v<T, bool>) {
+                out = token == "true" || token == "1";
+            }
+            else {
+                std::errc ec = Argy::CliData::toNumber(token, out);
+                if (ec == std::errc::result_out_of_range && !list)
+                    ARGY_THROW(Argy::OutOfRangeException("Value out of range for argument '" + key(option) + "': " + std::string(token)));
+                if (ec == std::errc::result_out_of_range)
+                    ARGY_THROW(Argy::InvalidValueException("Value out of range in list for argument '" + key(option) + "': " + std::string(token)));
+                if (ec != std::errc())
+                    ARGY_THROW(Argy::InvalidValueException((list ? "Invalid value in list for argument '" : "Invalid value for argument '") +
+                                                           key(option) + "': " + std::string(token)));
+            }
+        }
+
+        template<typename T>
+        void convert(int option, std::string_view token, std::vector<T>& out) {
+            T value{};
+            convert(option, token, value);
+            out.push_back(value);
+        }
+
+)";
+
+        os << "        /// A flag was seen: set bools, and start lists over as CliParser does\n"
+           << "        inline void begin(Options& o, int option) {\n";
+        bool anyBegin = false;
+        for (const OptionSpec& spec : options)
+            anyBegin = anyBegin || spec.type == ArgType::Bool || CliData::isListType(spec.type);
+        if (!anyBegin) os << "            (void)o;\n";
+        os << "            switch (option) {\n";
+        for (size_t i = 0; i < n; ++i) {
+            if (options[i].type == ArgType::Bool) os << "            case " << i << ": o." << options[i].member << " = true; break;\n";
+            else if (CliData::isListType(options[i].type)) os << "            case " << i << ": o." << options[i].member << ".clear(); break;\n";
+        }
+        os << "            default: break;\n"
+           << "            }\n"
+           << "        }\n\n";
+
+        os << "        /// A value token for the option\n"
+           << "        inline void store(Options& o, int option, std::string_view token) {\n";
+        bool anyStore = false;
+        for (const OptionSpec& spec : options) anyStore = anyStore || spec.type != ArgType::Bool;
+        if (!anyStore) os << "            (void)o;\n"
+                          << "            (void)token;\n";
+        os << "            switch (option) {\n";
+        for (size_t i = 0; i < n; ++i) {
+            if (options[i].type == ArgType::Bool) continue;
+            os << "            case " << i << ": convert(option, token, o." << options[i].member << "); break;\n";
+        }
+        os << "            default: break;\n"
+           << "            }\n"
+           << "        }\n\n";
+
+        os << "        /// Run the declared validators, in declaration order\n"
+           << "        inline void validate(const Options& o) {\n";
+        bool anyValidator = false;
+        for (const OptionSpec& spec : options) {
+            for (const std::string& validator : spec.validators) {
+                anyValidator = true;
+                // String validators check each element of a string list
+                bool each = spec.type == ArgType::StringList;
+                os << "            {\n"
+                   << "                static const auto check = " << validator << ";\n";
+                if (each) os << "                for (const std::string& value : o." << spec.member << ") check(" << SchemaReader::quote(spec.key) << ", value);\n";
+                else os << "                check(" << SchemaReader::quote(spec.key) << ", o." << spec.member << ");\n";
+                os << "            }\n";
+            }
+        }
+        if (!anyValidator) os << "            (void)o;\n";
+        os << "        }\n\n";
+
+        os << R"(        template<typename TokenAt>
+        Options parse(size_t argc, TokenAt tokenAt) {
+            Options o;
+            int current = -1; // option waiting for its value(s)
+            size_t positional = 0;
+            bool positionalOnly = false;
+            for (size_t i = 1; i < argc; ++i) {
+                std::string_view token = tokenAt(i);
+                Argy::CliData::TokenKind kind = positionalOnly ? Argy::CliData::TokenKind::Value : Argy::CliData::classifyToken(token);
+                switch (kind) {
+                case Argy::CliData::TokenKind::Separator:
+                    positionalOnly = true;
+                    break;
+                case Argy::CliData::TokenKind::LongFlag:
+                case Argy::CliData::TokenKind::ShortFlag: {
+                    if (token == "--help" || token == "-h") {
+                        o.helpRequested = true;
+                        return o;
+                    }
+                    current = find(token.substr(kind == Argy::CliData::TokenKind::LongFlag ? 2 : 1));
+                    if (current < 0) {
+                        ARGY_THROW(Argy::UnknownArgumentException((kind == Argy::CliData::TokenKind::LongFlag ? "Unknown argument: " : "Unknown short argument: ") +
+                                                                  std::string(token)));
+                    }
+                    if (types[current] == Argy::CliData::ArgType::Bool || Argy::CliData::isListType(types[current])) {
+                        o.given[current] = true;
+                        begin(o, current);
+                        if (types[current] == Argy::CliData::ArgType::Bool) current = -1;
+                    }
+                    break;
+                }
+                case Argy::CliData::TokenKind::NegativeNumber:
+                case Argy::CliData::TokenKind::Value:
+                    if (current >= 0 && !positionalOnly) {
+                        o.given[current] = true;
+                        store(o, current, token);
+                        if (!Argy::CliData::isListType(types[current])) current = -1;
+                    }
+                    else {
+                        if (positional >= positionals.size())
+                            ARGY_THROW(Argy::UnexpectedPositionalArgumentException("Unexpected positional argument: " + std::string(token)));
+                        o.given[positionals[positional]] = true;
+                        store(o, positionals[positional++], token);
+                    }
+                    break;
+                }
+            }
+)";
+        os << "            // Required options: those declared without a default\n";
+        for (size_t i = 0; i < n; ++i) {
+            if (options[i].defaults) continue;
+            bool list = CliData::isListType(options[i].type);
+            os << "            if (!o.given[" << i << "]) ARGY_THROW(Argy::MissingArgumentException("
+               << SchemaReader::quote(std::string(list ? "Missing required list argument: " : "Missing required argument: ") + options[i].key) << "));\n";
+        }
+        os << R"(            validate(o);
+            return o;
+        }
+    }
+
+    inline bool Options::has(std::string_view name) const {
+        int option = detail::find(name);
+        return option >= 0 && given[option];
+    }
+
+    /// @brief Parse the command line given to main().
+    /// @throws Argy::Exception subclasses on errors, as Argy::CliParser::parse() does.
+    inline Options parse(int argc, const char* const* argv) {
+        return detail::parse(argc > 0 ? static_cast<size_t>(argc) : 0, [argv](size_t i) { return std::string_view(argv[i]); });
+    }
+
+    /// @brief Parse a tokenized command line; args[0] is the program name.
+    /// @throws Argy::Exception subclasses on errors, as Argy::CliParser::parse() does.
+    inline Options parse(const std::vector<std::string_view>& args) {
+        return detail::parse(args.size(), [&args](size_t i) { return args[i]; });
+    }
+}
+)";
+    }
+}
+
+int main(int argc, char* argv[]) {
+    CliParser cli(argc, argv);
+    cli.setHelpDescription("Compile an option schema file into a specialized parser header.");
+    cli.addString("schema", "Schema file to read").isFile();
+    cli.addString({"-o", "--output"}, "Header file to write");
+    cli.addString({"-n", "--namespace"}, "Namespace of the generated code", "cli");
+    try {
+        auto args = cli.parse();
+        std::string schemaPath = args.getString("schema");
+        SchemaSpec schema = SchemaReader(schemaPath).read();
+
+        std::ostringstream header;
+        std::string source = std::filesystem::path(schemaPath).filename().string();
+        writeHeader(header, schema, args.getString("namespace"), source);
+
+        std::string output = args.getString("output");
+        std::ofstream out(output, std::ios::binary | std::ios::trunc);
+        if (!out || !(out << header.str()) || !out.flush()) {
+            std::cerr << "argy-gen: cannot write " << output << "\n";
+            return 1;
+        }
+    }
+    catch (const Argy::Exception& e) {
+        std::cerr << "argy-gen: " << e.what() << "\n";
+        return 1;
+    }
+    return 0;
+}